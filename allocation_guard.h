@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+// Debug hook for keeping the frame loop allocation-free. Executables that
+// compile allocation_guard.cpp with BOWLING_ALLOCATION_GUARD (the game in
+// Debug builds, and always the allocation test) replace every global
+// operator new, aligned forms included, with a counting version; otherwise
+// nothing is counted and the guard compiles away.
+
+// Heap allocations made through operator new so far, 0 if not counting
+std::uint64_t allocationCount();
+
+// Fails the process as soon as a frame after warm-up allocates, naming the
+// frame and how many allocations it made
+class FrameAllocationGuard {
+public:
+    explicit FrameAllocationGuard(int warmupFrames) : warmupFrames(warmupFrames) {}
+
+#ifdef BOWLING_ALLOCATION_GUARD
+    void beginFrame() { frameStart = allocationCount(); }
+    void endFrame();
+#else
+    void beginFrame() {}
+    void endFrame() {}
+#endif
+
+private:
+    int warmupFrames;
+    int frame = 0;
+    std::uint64_t frameStart = 0;
+};
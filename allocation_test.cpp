@@ -0,0 +1,130 @@
+// Steps warmed-up simulations through games of bot throws and resets, and
+// through the optimizer's simulateThrow, and records input past the replay
+// recorder's reserve, with every global operator new counted. Fails if any
+// tick after warm-up, or any record, allocates.
+//
+//   bowling_allocation_test
+
+#include <cstdint>
+#include <cstdio>
+
+#include "allocation_guard.h"
+#include "lane.h"
+#include "replay.h"
+#include "split_mix64.h"
+
+namespace {
+
+const int warmupTicks = 20000;
+const int checkedTicks = 60000;
+const int warmupThrows = 16;
+const int checkedThrows = 200;
+const int recordedChanges = 50000;
+
+// Play the lane's bot for ticks ticks, throwing and starting new games as it
+// goes. Returns false at the first tick that allocates, if checking.
+bool playTicks(Lane& lane, int ticks, bool check, const char* name) {
+    for (int tick = 0; tick < ticks; ++tick) {
+        std::uint64_t before = allocationCount();
+        lane.tick(InputState());
+        std::uint64_t made = allocationCount() - before;
+        if (check && made > 0) {
+            std::fprintf(stderr, "%s: tick %d allocated %llu times (throw %d)\n", name, tick,
+                         static_cast<unsigned long long>(made), lane.simulation.throws);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whole throws on a fresh rack each, as the optimizer plays them
+bool playThrows(Simulation& simulation, int throws, bool check, const char* name) {
+    SplitMix64 random{7};
+    for (int i = 0; i < throws; ++i) {
+        float x = random.uniform(simulation.tuning.laneLeftEdge, simulation.tuning.laneRightEdge);
+        float power = random.uniform(0.0f, 10.0f);
+        std::uint64_t before = allocationCount();
+        simulation.simulateThrow(x, power);
+        std::uint64_t made = allocationCount() - before;
+        if (check && made > 0) {
+            std::fprintf(stderr, "%s: simulateThrow %d allocated %llu times\n", name, i,
+                         static_cast<unsigned long long>(made));
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkLane(const char* name, int stressPins, const Level& level) {
+    Lane lane(defaultTickRate, stressPins, 1, true, level);
+    playTicks(lane, warmupTicks, false, name);
+    if (!playTicks(lane, checkedTicks, true, name)) {
+        return false;
+    }
+
+    Simulation& simulation = lane.simulation;
+    playThrows(simulation, warmupThrows, false, name);
+    if (!playThrows(simulation, checkedThrows, true, name)) {
+        return false;
+    }
+    std::printf("%s: %d ticks and %d throws without allocating\n", name, checkedTicks, checkedThrows);
+    return true;
+}
+
+// A change of input every tick, growing the buffer between ticks as the
+// frame loop does
+bool checkRecorder() {
+    Simulation simulation(defaultTickRate);
+    ReplayRecorder recorder;
+    recorder.begin(simulation, defaultTickRate, 0);
+    for (int i = 0; i < recordedChanges; ++i) {
+        InputState input = {};
+        input.left = i % 2 == 0;
+        std::uint64_t before = allocationCount();
+        recorder.record(input, 1);
+        std::uint64_t made = allocationCount() - before;
+        if (made > 0) {
+            std::fprintf(stderr, "recorder: change %d allocated %llu times\n", i,
+                         static_cast<unsigned long long>(made));
+            return false;
+        }
+        recorder.reserveAhead();
+    }
+    if (recorder.finish(simulation).inputs.size() != static_cast<std::size_t>(recordedChanges)) {
+        std::fprintf(stderr, "recorder: changes were dropped\n");
+        return false;
+    }
+    std::printf("recorder: %d changes without allocating\n", recordedChanges);
+    return true;
+}
+
+}
+
+int main() {
+    // The counter must see plain and over-aligned allocations (PinStore's
+    // cache-line arena), or the test proves nothing
+    struct alignas(64) CacheLine {
+        unsigned char bytes[64];
+    };
+    std::uint64_t before = allocationCount();
+    int* volatile probe = new int(0);
+    delete probe;
+    CacheLine* volatile alignedProbe = new CacheLine();
+    delete alignedProbe;
+    if (allocationCount() != before + 2) {
+        std::fprintf(stderr, "operator new is not being counted\n");
+        return 1;
+    }
+
+    Level wideRack;
+    wideRack.name = "wide";
+    wideRack.tuning.laneLeftEdge = -0.8f;
+    wideRack.tuning.laneRightEdge = 0.8f;
+    appendTriangleRack(wideRack.pins, 6, 0.05f, 0.85f, 0.1f, 0.03f);
+
+    bool passed = checkLane("standard", 0, Level());
+    passed = checkLane("custom", 0, wideRack) && passed;
+    passed = checkLane("stress", 500, Level()) && passed;
+    passed = checkRecorder() && passed;
+    return passed ? 0 : 1;
+}
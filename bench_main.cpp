@@ -0,0 +1,340 @@
+// Microbenchmarks for the physics and render-preparation hot paths.
+//
+// Every benchmark runs warm-up samples that are thrown away, then timed
+// samples; a sample is a fixed number of operations, timed as a whole, with
+// untimed setup (e.g. restoring a mid-throw keyframe) before it. Results are
+// reported per operation as min, median, p99 and mean.
+//
+//   bowling_bench [--filter TEXT] [--warmup N] [--samples N] [--json FILE]
+//                 [--replay FILE]...
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "lane.h"
+#include "render_prep.h"
+#include "replay.h"
+#include "simulation.h"
+#include "snapshot_ring.h"
+#include "split_mix64.h"
+
+namespace {
+
+const int benchPinCounts[] = {10, 100, 1000, 10000};
+const std::uint32_t syntheticReplayTicks = 60 * 120; // A minute of bot play at the default tick rate
+
+struct BenchSettings {
+    const char* filter = nullptr;
+    int warmupSamples = 5;
+    int samples = 50;
+    const char* jsonPath = nullptr;
+    std::vector<const char*> replayPaths;
+};
+
+struct BenchResult {
+    std::string name;
+    int pins;
+    int opsPerSample;
+    double minNs, medianNs, p99Ns, meanNs;
+};
+
+void writeJsonString(FILE* file, const std::string& text) {
+    std::fputc('"', file);
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+class BenchRunner {
+public:
+    explicit BenchRunner(const BenchSettings& settings) : settings(settings) {}
+
+    bool selected(const std::string& name) const {
+        return !settings.filter || name.find(settings.filter) != std::string::npos;
+    }
+
+    // Time body over samples; setup runs untimed before each sample. Both
+    // are called with no arguments; body performs opsPerSample operations.
+    template <typename Setup, typename Body>
+    void run(const std::string& name, int pins, int opsPerSample, Setup&& setup, Body&& body) {
+        if (!selected(name)) {
+            return;
+        }
+        sampleNs.clear();
+        for (int sample = 0; sample < settings.warmupSamples + settings.samples; ++sample) {
+            setup();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            if (sample >= settings.warmupSamples) {
+                sampleNs.push_back(std::chrono::duration<double, std::nano>(end - start).count() / opsPerSample);
+            }
+        }
+        if (sampleNs.empty()) {
+            return;
+        }
+
+        std::sort(sampleNs.begin(), sampleNs.end());
+        double sum = 0.0;
+        for (double ns : sampleNs) {
+            sum += ns;
+        }
+        std::size_t p99Index = std::min(sampleNs.size() - 1, (sampleNs.size() * 99 + 99) / 100 - 1);
+        BenchResult result = {name, pins, opsPerSample, sampleNs.front(), sampleNs[sampleNs.size() / 2],
+                              sampleNs[p99Index], sum / sampleNs.size()};
+        std::printf("%-28s %6d pins %12.3f %12.3f %12.3f us\n", name.c_str(), pins, result.minNs / 1000.0,
+                    result.medianNs / 1000.0, result.p99Ns / 1000.0);
+        std::fflush(stdout);
+        results.push_back(result);
+    }
+
+    bool writeJson(const char* path) const {
+        FILE* file = std::fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+        std::fprintf(file, "{\n  \"unit\": \"ns\",\n  \"warmupSamples\": %d,\n  \"samples\": %d,\n  \"benchmarks\": [\n",
+                     settings.warmupSamples, settings.samples);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& result = results[i];
+            std::fprintf(file, "    {\"name\": ");
+            writeJsonString(file, result.name);
+            std::fprintf(file, ", \"pins\": %d, \"opsPerSample\": %d, \"min\": %.1f, \"median\": %.1f, \"p99\": %.1f, "
+                         "\"mean\": %.1f}%s\n",
+                         result.pins, result.opsPerSample, result.minNs, result.medianNs, result.p99Ns, result.meanNs,
+                         i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+        return std::fclose(file) == 0;
+    }
+
+private:
+    const BenchSettings& settings;
+    std::vector<double> sampleNs;
+    std::vector<BenchResult> results;
+};
+
+// A game with pins bottles (10 is the standard rack), a full-power throw
+// down the middle already in among them
+Simulation midThrow(int pins) {
+    Simulation simulation;
+    simulation.setStressRack(pins == 10 ? 0 : pins);
+    simulation.powerLevel = 10.0f;
+    simulation.throwBall();
+    for (int tick = 0; tick < 2000 && !simulation.bottles.rack().anyToppled(); ++tick) {
+        simulation.step();
+    }
+    for (int tick = 0; tick < 4; ++tick) {
+        simulation.step();
+    }
+    return simulation;
+}
+
+// Stop the run if a snapshot call failed, rather than report its timing
+void snapshotChecked(bool succeeded, const char* operation) {
+    if (!succeeded) {
+        std::fprintf(stderr, "snapshot %s failed; aborting the benchmark run\n", operation);
+        std::abort();
+    }
+}
+
+void benchPhases(BenchRunner& runner, int pins) {
+    const int ticksPerSample = pins >= 10000 ? 4 : pins >= 1000 ? 16 : 64;
+    Simulation simulation = midThrow(pins);
+    std::vector<std::uint8_t> keyframe;
+    simulation.saveState(keyframe);
+    auto restore = [&] { simulation.loadState(keyframe.data(), keyframe.size()); };
+
+    runner.run("updateBall", pins, ticksPerSample, restore, [&] {
+        for (int tick = 0; tick < ticksPerSample; ++tick) {
+            simulation.updateBall();
+        }
+    });
+    runner.run("updateBottles", pins, ticksPerSample, restore, [&] {
+        for (int tick = 0; tick < ticksPerSample; ++tick) {
+            simulation.updateBottles();
+        }
+    });
+    runner.run("handleCollisions", pins, ticksPerSample, restore, [&] {
+        for (int tick = 0; tick < ticksPerSample; ++tick) {
+            simulation.handleCollisions();
+        }
+    });
+    runner.run("step", pins, ticksPerSample, restore, [&] {
+        for (int tick = 0; tick < ticksPerSample; ++tick) {
+            simulation.step();
+        }
+    });
+
+    // setStressRack rebuilds the rack through initBottles
+    int rackPins = pins == 10 ? 0 : pins;
+    runner.run("initBottles", pins, 1, [] {}, [&] { simulation.setStressRack(rackPins); });
+
+    std::vector<CircleInstance> instances;
+    instances.reserve(pins + 1);
+    restore();
+    runner.run("appendCircleInstances", pins, 16, [] {}, [&] {
+        for (int frame = 0; frame < 16; ++frame) {
+            instances.clear();
+            appendCircleInstances(simulation, instances);
+        }
+    });
+
+    // Rollback: snapshot into a ring and restore from it, 64 at a time. A
+    // failed push or restore would time nothing, so it stops the run.
+    const int snapshotsPerSample = 64;
+    SnapshotRing ring(snapshotsPerSample, simulation.snapshotSize());
+    auto fillRing = [&] {
+        ring.clear();
+        for (int i = 0; i < snapshotsPerSample; ++i) {
+            snapshotChecked(ring.push(simulation), "push");
+        }
+    };
+    runner.run("snapshot/save", pins, snapshotsPerSample, [&] { ring.clear(); }, [&] {
+        for (int i = 0; i < snapshotsPerSample; ++i) {
+            snapshotChecked(ring.push(simulation), "push");
+        }
+    });
+    runner.run("snapshot/restore", pins, snapshotsPerSample, fillRing, [&] {
+        for (int i = 0; i < snapshotsPerSample; ++i) {
+            snapshotChecked(ring.restore(static_cast<std::size_t>(i), simulation), "restore");
+        }
+    });
+}
+
+void benchThrows(BenchRunner& runner) {
+    Simulation simulation;
+    runner.run("simulateThrow/strike", 10, 1, [] {}, [&] { simulation.simulateThrow(0.0f, 10.0f); });
+    // A second ball at what a first one down the left side left standing
+    simulation.simulateThrow(-0.1f, 4.0f);
+    runner.run("evaluateThrow/spare", 10, 1, [] {}, [&] { simulation.evaluateThrow(0.1f, 10.0f); });
+
+    // A spread of aims and powers, the optimizer's workload
+    std::vector<Throw> batch;
+    SplitMix64 random{1};
+    for (int i = 0; i < 64; ++i) {
+        batch.push_back({random.uniform(Tuning().laneLeftEdge, Tuning().laneRightEdge), random.uniform(0.0f, 10.0f)});
+    }
+    std::vector<ThrowResult> results(batch.size());
+    runner.run("simulateThrow/spread", 10, static_cast<int>(batch.size()), [] {}, [&] {
+        simulation.simulateBatch(batch.data(), batch.size(), results.data());
+    });
+}
+
+// One frame of the 64-lane alley: lay out the tiles and gather every lane's circles
+void benchAlleyFrame(BenchRunner& runner) {
+    const int laneCount = 64;
+    Alley alley(laneCount, defaultTickRate, 0);
+    for (Lane& lane : alley.lanes) {
+        for (int tick = 0; tick < 600; ++tick) {
+            lane.tick(InputState{});
+        }
+    }
+    std::vector<LaneTile> tiles;
+    std::vector<CircleInstance> instances;
+    tiles.reserve(laneCount);
+    instances.reserve(laneCount * 11);
+    runner.run("renderPrep/alley64", laneCount * 10, 16, [] {}, [&] {
+        for (int frame = 0; frame < 16; ++frame) {
+            layoutLaneTiles(laneCount, tiles);
+            instances.clear();
+            for (int lane = 0; lane < laneCount; ++lane) {
+                appendCircleInstances(alley.lanes[lane].simulation, instances, tiles[lane]);
+            }
+        }
+    });
+}
+
+// A bot playing one lane, recorded like the game records the player
+Replay syntheticReplay() {
+    Lane lane(defaultTickRate, 0, 7, true);
+    ReplayRecorder recorder;
+    recorder.begin(lane.simulation, defaultTickRate, 0);
+    for (std::uint32_t tick = 0; tick < syntheticReplayTicks; ++tick) {
+        InputState input = lane.bot.nextInput(lane.simulation);
+        recorder.record(input, 1);
+        lane.simulation.applyInput(input);
+        lane.simulation.step();
+    }
+    return recorder.finish(lane.simulation);
+}
+
+// Re-simulate a whole replay headless; reported per tick
+void benchReplay(BenchRunner& runner, const std::string& name, const Replay& replay) {
+    ReplayPlayer probe(replay);
+    if (!probe.rackMatches()) {
+        std::fprintf(stderr, "%s: recorded on a different rack than this build sets up\n", name.c_str());
+        return;
+    }
+    int ticks = static_cast<int>(std::max<std::uint32_t>(replay.ticks, 1));
+    int pins = static_cast<int>(replay.rack.size() / 3);
+    bool verified = true;
+    runner.run(name, pins, ticks, [] {}, [&] {
+        ReplayPlayer player(replay);
+        player.advance(replay.ticks);
+        verified = verified && player.verified();
+    });
+    if (!verified && runner.selected(name)) {
+        std::fprintf(stderr, "%s: re-simulation did not match the recording\n", name.c_str());
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    BenchSettings settings;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            settings.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            settings.warmupSamples = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            settings.samples = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            settings.jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            settings.replayPaths.push_back(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter TEXT] [--warmup N] [--samples N] [--json FILE] [--replay FILE]...\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    BenchRunner runner(settings);
+    std::printf("%-28s %11s %12s %12s %12s\n", "benchmark", "", "min", "median", "p99");
+    for (int pins : benchPinCounts) {
+        benchPhases(runner, pins);
+    }
+    benchThrows(runner);
+    benchAlleyFrame(runner);
+
+    if (runner.selected("replay/synthetic")) {
+        benchReplay(runner, "replay/synthetic", syntheticReplay());
+    }
+    for (const char* path : settings.replayPaths) {
+        Replay replay;
+        const char* error = nullptr;
+        if (!readReplay(path, replay, error)) {
+            std::fprintf(stderr, "%s: %s\n", path, error);
+            return 1;
+        }
+        benchReplay(runner, std::string("replay/") + path, replay);
+    }
+
+    if (settings.jsonPath && !runner.writeJson(settings.jsonPath)) {
+        std::fprintf(stderr, "Could not write %s\n", settings.jsonPath);
+        return 1;
+    }
+    return 0;
+}
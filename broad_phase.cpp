@@ -0,0 +1,104 @@
+#include "broad_phase.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "collision_kernel.h"
+
+namespace {
+
+const float maxCell = 65535.0f;
+const float cellSlack = 1.01f; // Keeps rounding at cell borders from splitting touching pairs
+
+// Spread the low 16 bits of v so there is a zero bit between each
+std::uint32_t spreadBits(std::uint32_t v) {
+    v &= 0x0000ffff;
+    v = (v | (v << 8)) & 0x00ff00ff;
+    v = (v | (v << 4)) & 0x0f0f0f0f;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+std::uint32_t mortonKey(std::uint32_t cx, std::uint32_t cy) {
+    return spreadBits(cx) | (spreadBits(cy) << 1);
+}
+
+std::uint16_t toCell(float value, float origin, float inverseCellSize) {
+    float cell = std::floor((value - origin) * inverseCellSize);
+    return static_cast<std::uint16_t>(std::min(std::max(cell, 0.0f), maxCell));
+}
+
+}
+
+void UniformGrid::findPairs(const float* x0, const float* y0, const float* x1, const float* y1, const float* radius,
+                            std::size_t count, std::size_t activeCount, std::vector<ContactPair>& pairs) {
+    pairs.clear();
+    if (count < 2 || activeCount == 0) {
+        return;
+    }
+
+    // A circle's whole move fits in a circle around its midpoint, half the
+    // move larger than the circle itself
+    float minX = 0.5f * (x0[0] + x1[0]), minY = 0.5f * (y0[0] + y1[0]), maxBound = 0.0f;
+    for (std::size_t i = 0; i < count; ++i) {
+        float moveX = x1[i] - x0[i];
+        float moveY = y1[i] - y0[i];
+        minX = std::min(minX, 0.5f * (x0[i] + x1[i]));
+        minY = std::min(minY, 0.5f * (y0[i] + y1[i]));
+        maxBound = std::max(maxBound, radius[i] + 0.5f * std::sqrt(moveX * moveX + moveY * moveY));
+    }
+    float inverseCellSize = 1.0f / std::max(2.0f * maxBound * cellSlack, 1e-6f);
+
+    // Bin every circle and sort the bins along the Morton curve
+    entries.resize(count);
+    cellX.resize(count);
+    cellY.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        cellX[i] = toCell(0.5f * (x0[i] + x1[i]), minX, inverseCellSize);
+        cellY[i] = toCell(0.5f * (y0[i] + y1[i]), minY, inverseCellSize);
+        entries[i] = {mortonKey(cellX[i], cellY[i]), static_cast<std::uint32_t>(i)};
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.key < b.key || (a.key == b.key && a.index < b.index);
+    });
+
+    // Test each active circle against the later circles in its 3x3 neighbourhood
+    for (std::size_t i = 0; i < std::min(activeCount, count); ++i) {
+        int baseX = cellX[i];
+        int baseY = cellY[i];
+        for (int offsetY = -1; offsetY <= 1; ++offsetY) {
+            int cy = baseY + offsetY;
+            if (cy < 0 || cy > static_cast<int>(maxCell)) {
+                continue;
+            }
+            for (int offsetX = -1; offsetX <= 1; ++offsetX) {
+                int cx = baseX + offsetX;
+                if (cx < 0 || cx > static_cast<int>(maxCell)) {
+                    continue;
+                }
+                std::uint32_t key = mortonKey(static_cast<std::uint32_t>(cx), static_cast<std::uint32_t>(cy));
+                auto cell = std::lower_bound(entries.begin(), entries.end(), key, [](const Entry& entry, std::uint32_t k) {
+                    return entry.key < k;
+                });
+                for (; cell != entries.end() && cell->key == key; ++cell) {
+                    std::uint32_t j = cell->index;
+                    if (j <= i) {
+                        continue;
+                    }
+                    float dx0 = x0[j] - x0[i];
+                    float dy0 = y0[j] - y0[i];
+                    float ex = (x1[j] - x1[i]) - dx0;
+                    float ey = (y1[j] - y1[i]) - dy0;
+                    if (sweptCirclesOverlap(dx0, dy0, ex, ey, radius[j] + radius[i])) {
+                        pairs.push_back({static_cast<std::uint32_t>(i), j});
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end(), [](const ContactPair& a, const ContactPair& b) {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+}
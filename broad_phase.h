@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Two touching circles, first < second
+struct ContactPair {
+    std::uint32_t first, second;
+};
+
+// Uniform grid broad phase for swept circle-circle contact. Each circle is
+// binned by the midpoint of its move over the tick, and cells are as wide as
+// the largest circle's diameter plus its move, so circles that touch during
+// the tick always sit in the same or neighbouring cells. Cells are ordered
+// along a Morton curve so circles close on the lane are close in memory.
+class UniformGrid {
+public:
+    // Collect every pair that touches while moving from (x0, y0) to (x1, y1)
+    // and whose first circle is one of the leading activeCount circles,
+    // sorted by first then second. This is the order, and the test, of a
+    // brute-force double loop over findSweptCircleContacts.
+    void findPairs(const float* x0, const float* y0, const float* x1, const float* y1, const float* radius,
+                   std::size_t count, std::size_t activeCount, std::vector<ContactPair>& pairs);
+
+private:
+    struct Entry {
+        std::uint32_t key; // Morton code of the cell
+        std::uint32_t index;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<std::uint16_t> cellX, cellY;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Little-endian encoding shared by the replay and archive formats. Floats
+// are stored as their bit patterns, so they round-trip exactly.
+struct ByteWriter {
+    std::vector<std::uint8_t>& bytes;
+
+    void varint(std::uint64_t value) {
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void fixed(std::uint64_t value, int size) {
+        for (int i = 0; i < size; ++i) {
+            bytes.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void f32(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        fixed(bits, 4);
+    }
+
+    void f64(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        fixed(bits, 8);
+    }
+
+    void raw(const void* data, std::size_t size) {
+        const std::uint8_t* begin = static_cast<const std::uint8_t*>(data);
+        bytes.insert(bytes.end(), begin, begin + size);
+    }
+};
+
+// Bounds-checked reader; once a read runs off the end, ok is false and every
+// later read returns zeros
+struct ByteReader {
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t offset = 0;
+    bool ok = true;
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64 && offset < size; shift += 7) {
+            std::uint8_t byte = data[offset++];
+            value |= std::uint64_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        fail();
+        return 0;
+    }
+
+    std::uint64_t fixed(int bytes) {
+        if (!ok || size - offset < static_cast<std::size_t>(bytes)) {
+            fail();
+            return 0;
+        }
+        std::uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= std::uint64_t(data[offset++]) << (8 * i);
+        }
+        return value;
+    }
+
+    float f32() {
+        std::uint32_t bits = static_cast<std::uint32_t>(fixed(4));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double f64() {
+        std::uint64_t bits = fixed(8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Whether count more elements of elementSize bytes could still be read
+    bool has(std::uint64_t count, std::size_t elementSize) const {
+        return ok && count <= (size - offset) / elementSize;
+    }
+
+    void fail() {
+        ok = false;
+        offset = size;
+    }
+};
@@ -0,0 +1,56 @@
+#include "circle_mesh.h"
+
+#include <cmath>
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+const float maxPixelError = 0.5f; // Allowed gap between a chord and the true circle
+
+struct CircleTables {
+    std::vector<float> levels[circleLevelCount];
+    float maxPixelRadius[circleLevelCount]; // Largest radius each level draws within maxPixelError
+
+    CircleTables() {
+        for (int level = 0; level < circleLevelCount; ++level) {
+            int segments = minCircleSegments << level;
+            // A chord spanning angle a sits r * (1 - cos(a / 2)) inside the circle
+            maxPixelRadius[level] = static_cast<float>(maxPixelError / (1.0 - std::cos(pi / segments)));
+            std::vector<float>& points = levels[level];
+            points.reserve((segments + 1) * 2);
+            for (int i = 0; i <= segments; ++i) {
+                double angle = 2.0 * pi * (i % segments) / segments;
+                points.push_back(static_cast<float>(std::cos(angle)));
+                points.push_back(static_cast<float>(std::sin(angle)));
+            }
+        }
+    }
+};
+
+const CircleTables& circleTables() {
+    static const CircleTables tables;
+    return tables;
+}
+
+}
+
+int circleLevel(int segments) {
+    int level = 0;
+    while (level + 1 < circleLevelCount && (minCircleSegments << level) < segments) {
+        level++;
+    }
+    return level;
+}
+
+const std::vector<float>& unitCircle(int segments) {
+    return circleTables().levels[circleLevel(segments)];
+}
+
+int circleSegments(float pixelRadius) {
+    const CircleTables& tables = circleTables();
+    int level = 0;
+    while (level + 1 < circleLevelCount && pixelRadius > tables.maxPixelRadius[level]) {
+        level++;
+    }
+    return minCircleSegments << level;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <vector>
+
+// Fewest and most segments a circle is drawn with
+const int minCircleSegments = 8;
+const int maxCircleSegments = 128;
+// Levels of detail in between: 8, 16, 32, 64 and 128 segments
+const int circleLevelCount = 5;
+
+// Points of a unit circle with the given number of segments (a power of two
+// between minCircleSegments and maxCircleSegments), as interleaved x, y
+// pairs. The first point is repeated at the end to close a triangle fan.
+// Tables are computed once and shared.
+const std::vector<float>& unitCircle(int segments);
+
+// Level of detail a circle of segments segments is drawn at, the one
+// unitCircle uses: 0 for minCircleSegments, each level doubling the count
+int circleLevel(int segments);
+
+// Segment count that keeps a circle of the given on-screen radius within
+// half a pixel of round
+int circleSegments(float pixelRadius);
@@ -0,0 +1,99 @@
+#include "circle_renderer.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "circle_mesh.h"
+
+namespace {
+
+const char* vertexShaderSource = R"(#version 330 core
+layout(location = 0) in vec2 unitPosition;
+layout(location = 1) in vec3 circle; // x, y, radius
+layout(location = 2) in vec4 circleColor;
+out vec4 color;
+void main() {
+    gl_Position = vec4(circle.xy + unitPosition * circle.z, 0.0, 1.0);
+    color = circleColor;
+}
+)";
+
+const char* fragmentShaderSource = R"(#version 330 core
+in vec4 color;
+out vec4 fragColor;
+void main() {
+    fragColor = color;
+}
+)";
+
+}
+
+bool CircleRenderer::init(const GlFunctions& functions) {
+    gl = &functions;
+    program = buildShaderProgram(*gl, vertexShaderSource, fragmentShaderSource);
+    if (!program) {
+        return false;
+    }
+
+    // One triangle fan per level of detail: the centre, then the rim
+    std::vector<float> mesh;
+    for (int level = 0; level < circleLevelCount; ++level) {
+        const std::vector<float>& rim = unitCircle(minCircleSegments << level);
+        levelFirst[level] = static_cast<GLint>(mesh.size() / 2);
+        levelCountVertices[level] = static_cast<GLsizei>(rim.size() / 2 + 1);
+        mesh.push_back(0.0f);
+        mesh.push_back(0.0f);
+        mesh.insert(mesh.end(), rim.begin(), rim.end());
+    }
+
+    gl->genVertexArrays(1, &vertexArray);
+    gl->bindVertexArray(vertexArray);
+
+    gl->genBuffers(1, &meshBuffer);
+    gl->bindBuffer(GL_ARRAY_BUFFER, meshBuffer);
+    gl->bufferData(GL_ARRAY_BUFFER, mesh.size() * sizeof(float), mesh.data(), GL_STATIC_DRAW);
+    gl->enableVertexAttribArray(0);
+    gl->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+
+    gl->genBuffers(1, &instanceBuffer);
+    gl->bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    gl->enableVertexAttribArray(1);
+    gl->vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(CircleInstance),
+                            reinterpret_cast<const void*>(offsetof(CircleInstance, x)));
+    gl->vertexAttribDivisor(1, 1);
+    gl->enableVertexAttribArray(2);
+    gl->vertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CircleInstance),
+                            reinterpret_cast<const void*>(offsetof(CircleInstance, color)));
+    gl->vertexAttribDivisor(2, 1);
+
+    gl->bindVertexArray(0);
+    gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void CircleRenderer::draw(const std::vector<CircleInstance>& instances, float pixelsPerUnit) {
+    if (instances.empty()) {
+        return;
+    }
+
+    // The whole batch shares the level of detail of its largest circle
+    float maxRadius = 0.0f;
+    for (const CircleInstance& instance : instances) {
+        maxRadius = std::max(maxRadius, instance.radius);
+    }
+    int level = circleLevel(circleSegments(maxRadius * pixelsPerUnit));
+
+    // Orphan last frame's storage so the upload does not wait on the GPU
+    gl->bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    instanceCapacity = std::max(instances.size(), instanceCapacity);
+    gl->bufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(CircleInstance), nullptr, GL_STREAM_DRAW);
+    gl->bufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(CircleInstance), instances.data());
+
+    gl->useProgram(program);
+    gl->bindVertexArray(vertexArray);
+    gl->drawArraysInstanced(GL_TRIANGLE_FAN, levelFirst[level], levelCountVertices[level],
+                            static_cast<GLsizei>(instances.size()));
+    gl->bindVertexArray(0);
+    gl->useProgram(0);
+    gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+}
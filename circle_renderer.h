@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "circle_mesh.h"
+#include "gl_functions.h"
+#include "render_prep.h"
+
+// Draws any number of filled circles with a single instanced draw call. The
+// unit-circle fans for every level of detail share one static buffer; the
+// per-circle position, radius and colour are streamed once per frame.
+class CircleRenderer {
+public:
+    // Needs a current OpenGL 3.3 context. Returns false if the shaders fail.
+    bool init(const GlFunctions& functions);
+
+    // Upload this frame's circles and draw them. pixelsPerUnit converts lane
+    // units to pixels for picking the level of detail.
+    void draw(const std::vector<CircleInstance>& instances, float pixelsPerUnit);
+
+private:
+    const GlFunctions* gl = nullptr;
+    GLuint program = 0;
+    GLuint vertexArray = 0;
+    GLuint meshBuffer = 0;
+    GLuint instanceBuffer = 0;
+    std::size_t instanceCapacity = 0;
+    GLint levelFirst[circleLevelCount] = {};
+    GLsizei levelCountVertices[circleLevelCount] = {};
+};
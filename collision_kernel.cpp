@@ -0,0 +1,109 @@
+#include "collision_kernel.h"
+
+#if !defined(BOWLING_SCALAR_KERNEL) && defined(__AVX2__)
+#define BOWLING_KERNEL_AVX2
+#include <immintrin.h>
+#elif !defined(BOWLING_SCALAR_KERNEL) && (defined(__SSE4_1__) || defined(__SSE2__) || defined(_M_X64))
+#define BOWLING_KERNEL_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+// Append the set lanes of a comparison mask as indices
+inline std::size_t appendHits(int mask, int lanes, std::size_t base, std::uint32_t* hits, std::size_t hitCount) {
+    for (int lane = 0; lane < lanes; ++lane) {
+        if (mask & (1 << lane)) {
+            hits[hitCount++] = static_cast<std::uint32_t>(base + lane);
+        }
+    }
+    return hitCount;
+}
+
+}
+
+std::size_t findSweptCircleContacts(const float* x0, const float* y0, const float* x1, const float* y1,
+                                    const float* radius, std::size_t first, std::size_t count,
+                                    float c0x, float c0y, float c1x, float c1y, float cr, std::uint32_t* hits) {
+    std::size_t hitCount = 0;
+    std::size_t i = first;
+
+    // Same arithmetic as sweptCirclesOverlap, lane by lane
+#if defined(BOWLING_KERNEL_AVX2)
+    const __m256 startX = _mm256_set1_ps(c0x);
+    const __m256 startY = _mm256_set1_ps(c0y);
+    const __m256 endX = _mm256_set1_ps(c1x);
+    const __m256 endY = _mm256_set1_ps(c1y);
+    const __m256 centerR = _mm256_set1_ps(cr);
+    const __m256 minSweep = _mm256_set1_ps(minSweepSquared);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx0 = _mm256_sub_ps(_mm256_loadu_ps(x0 + i), startX);
+        __m256 dy0 = _mm256_sub_ps(_mm256_loadu_ps(y0 + i), startY);
+        __m256 ex = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(x1 + i), endX), dx0);
+        __m256 ey = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(y1 + i), endY), dy0);
+        __m256 sweepSquared = _mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey)), minSweep);
+        __m256 along = _mm256_add_ps(_mm256_mul_ps(dx0, ex), _mm256_mul_ps(dy0, ey));
+        __m256 t = _mm256_div_ps(_mm256_xor_ps(along, signBit), sweepSquared);
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+        __m256 closestX = _mm256_add_ps(dx0, _mm256_mul_ps(t, ex));
+        __m256 closestY = _mm256_add_ps(dy0, _mm256_mul_ps(t, ey));
+        __m256 reach = _mm256_add_ps(_mm256_loadu_ps(radius + i), centerR);
+        __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(closestX, closestX), _mm256_mul_ps(closestY, closestY));
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(distanceSquared, _mm256_mul_ps(reach, reach), _CMP_LT_OQ));
+        if (mask) {
+            hitCount = appendHits(mask, 8, i, hits, hitCount);
+        }
+    }
+#elif defined(BOWLING_KERNEL_SSE)
+    const __m128 startX = _mm_set1_ps(c0x);
+    const __m128 startY = _mm_set1_ps(c0y);
+    const __m128 endX = _mm_set1_ps(c1x);
+    const __m128 endY = _mm_set1_ps(c1y);
+    const __m128 centerR = _mm_set1_ps(cr);
+    const __m128 minSweep = _mm_set1_ps(minSweepSquared);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx0 = _mm_sub_ps(_mm_loadu_ps(x0 + i), startX);
+        __m128 dy0 = _mm_sub_ps(_mm_loadu_ps(y0 + i), startY);
+        __m128 ex = _mm_sub_ps(_mm_sub_ps(_mm_loadu_ps(x1 + i), endX), dx0);
+        __m128 ey = _mm_sub_ps(_mm_sub_ps(_mm_loadu_ps(y1 + i), endY), dy0);
+        __m128 sweepSquared = _mm_max_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), minSweep);
+        __m128 along = _mm_add_ps(_mm_mul_ps(dx0, ex), _mm_mul_ps(dy0, ey));
+        __m128 t = _mm_div_ps(_mm_xor_ps(along, signBit), sweepSquared);
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        __m128 closestX = _mm_add_ps(dx0, _mm_mul_ps(t, ex));
+        __m128 closestY = _mm_add_ps(dy0, _mm_mul_ps(t, ey));
+        __m128 reach = _mm_add_ps(_mm_loadu_ps(radius + i), centerR);
+        __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(closestX, closestX), _mm_mul_ps(closestY, closestY));
+        int mask = _mm_movemask_ps(_mm_cmplt_ps(distanceSquared, _mm_mul_ps(reach, reach)));
+        if (mask) {
+            hitCount = appendHits(mask, 4, i, hits, hitCount);
+        }
+    }
+#endif
+
+    // Scalar fallback and the tail of the vector loops
+    for (; i < count; ++i) {
+        float dx0 = x0[i] - c0x;
+        float dy0 = y0[i] - c0y;
+        if (sweptCirclesOverlap(dx0, dy0, (x1[i] - c1x) - dx0, (y1[i] - c1y) - dy0, radius[i] + cr)) {
+            hits[hitCount++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    return hitCount;
+}
+
+const char* collisionKernelName() {
+#if defined(BOWLING_KERNEL_AVX2)
+    return "avx2";
+#elif defined(BOWLING_KERNEL_SSE)
+    return "sse";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Smallest squared sweep length treated as motion; shorter sweeps are tested
+// at their start position
+const float minSweepSquared = 1e-20f;
+
+// Whether two circles moving in straight lines over a tick come within reach
+// of each other. (dx0, dy0) is the offset between them at the start of the
+// tick and (ex, ey) how that offset changes by the end. This is the
+// closest-approach test every swept path shares, so they all agree.
+inline bool sweptCirclesOverlap(float dx0, float dy0, float ex, float ey, float reach) {
+    float sweepSquared = ex * ex + ey * ey;
+    float along = dx0 * ex + dy0 * ey;
+    float t = -along / (sweepSquared > minSweepSquared ? sweepSquared : minSweepSquared);
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    float closestX = dx0 + t * ex;
+    float closestY = dy0 + t * ey;
+    return closestX * closestX + closestY * closestY < reach * reach;
+}
+
+// Continuous collision detection against a run of circles: circle i moves
+// from (x0[i], y0[i]) to (x1[i], y1[i]) during the tick and the query circle
+// of radius cr from (c0x, c0y) to (c1x, c1y). Circle i in [first, count) is a
+// hit if the two come within reach (radius[i] + cr) at any point of the tick,
+// so fast circles cannot pass through each other between ticks; circles that
+// do not move are hits exactly when they overlap. The test is
+// sweptCirclesOverlap, on squared distances, so no square roots are taken.
+// Indices are written to hits in ascending order, which must have room for
+// count - first entries; returns the number of hits.
+//
+// Built for AVX2 (8 circles per step) or SSE4 (4 per step) depending on the
+// BOWLING_SIMD build setting, with a scalar fallback. Every path gives the
+// same answer.
+std::size_t findSweptCircleContacts(const float* x0, const float* y0, const float* x1, const float* y1,
+                                    const float* radius, std::size_t first, std::size_t count,
+                                    float c0x, float c0y, float c1x, float c1y, float cr, std::uint32_t* hits);
+
+// Name of the instruction set the kernel was built for
+const char* collisionKernelName();
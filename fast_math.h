@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Deterministic float math for the simulation. Every function is built only
+// from IEEE add, multiply, divide and square root, which give the same
+// correctly rounded result on every platform, so nothing depends on the libm
+// a machine happens to ship and a recorded replay plays back bit for bit
+// after an OS upgrade. The build turns off FMA contraction (-ffp-contract=off)
+// so the compiler cannot fuse these operations differently per target.
+
+// Square root. IEEE requires it correctly rounded, so the hardware instruction
+// is already deterministic; with -fno-math-errno it never calls into libm.
+inline float fastSqrt(float x) {
+    return std::sqrt(x);
+}
+
+// 1 / sqrt(x) for x > 0, to about 5e-6 relative error: a bit-level first
+// guess refined by two Newton steps. The x86 rsqrtss estimate is not used
+// because Intel and AMD round it differently.
+inline float fastRsqrt(float x) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f375a86u - (bits >> 1);
+    float y;
+    std::memcpy(&y, &bits, sizeof(y));
+    float halfX = 0.5f * x;
+    y = y * (1.5f - halfX * y * y);
+    y = y * (1.5f - halfX * y * y);
+    return y;
+}
+
+// Sine and cosine of angle (radians), accurate to a few ulp for |angle| up
+// to a few thousand. Reduces to [-pi/4, pi/4] around the nearest multiple of
+// pi/2 and evaluates minimax polynomials there.
+inline void fastSinCos(float angle, float& sine, float& cosine) {
+    const float twoOverPi = 0.636619772367581f;
+    // pi/2 split so k * piOverTwoHigh is exact for the k used here
+    const float piOverTwoHigh = 1.5703125f;
+    const float piOverTwoMid = 4.837512969970703125e-4f;
+    const float piOverTwoLow = 7.54978995489188216e-8f;
+
+    float k = std::floor(angle * twoOverPi + 0.5f);
+    float r = ((angle - k * piOverTwoHigh) - k * piOverTwoMid) - k * piOverTwoLow;
+    float z = r * r;
+    float s = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+    float c = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+
+    switch (static_cast<std::int32_t>(k) & 3) {
+        case 0: sine = s; cosine = c; break;
+        case 1: sine = c; cosine = -s; break;
+        case 2: sine = -s; cosine = -c; break;
+        default: sine = -c; cosine = s; break;
+    }
+}
+
+const double ln2High = 6.93147180369123816490e-01; // ln 2 with its low bits
+const double ln2Low = 1.90821492927058770002e-10; // split off, so k * ln2High is exact
+
+// Natural log of a positive normal double as high + low, the low part
+// carrying bits the sum would round away. The binary exponent is split off
+// by hand and the rest is an atanh series, so no libm is involved.
+inline void fastLogParts(double x, double& high, double& low) {
+    // log(x) = k ln 2 + log(m), with m in [sqrt(1/2), sqrt(2))
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int k = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    bits = (bits & 0x000fffffffffffffull) | 0x3ff0000000000000ull;
+    double m;
+    std::memcpy(&m, &bits, sizeof(m));
+    if (m > 1.4142135623730951) {
+        m *= 0.5;
+        k++;
+    }
+    // log(m) = 2 atanh(s) = 2 (s + s^3/3 + s^5/5 + ...), |s| < 0.172
+    double s = (m - 1.0) / (m + 1.0);
+    double s2 = s * s;
+    double series = 0.0;
+    for (int term = 25; term >= 3; term -= 2) {
+        series = (series + 1.0 / term) * s2;
+    }
+    high = k * ln2High + 2.0 * s;
+    low = k * ln2Low + 2.0 * s * series;
+}
+
+// Natural log of a positive normal double, to about 1e-15 relative error
+inline double fastLog(double x) {
+    double high, low;
+    fastLogParts(x, high, low);
+    return high + low;
+}
+
+// base raised to exponent for base > 0, to about 1e-13 relative error:
+// far finer than the floats the results end up in. Goes through fastLogParts
+// and an exp series, so unlike std::pow the result is the same under every
+// libm. Results below the smallest normal double flush to 0. Used for
+// constants derived once from the tick rate, not per tick.
+inline double fastPow(double base, double exponent) {
+    double logBaseHigh, logBaseLow;
+    fastLogParts(base, logBaseHigh, logBaseLow);
+
+    // exp(y) = 2^n exp(r), with |r| <= ln 2 / 2
+    double y = exponent * logBaseHigh + exponent * logBaseLow;
+    double n = std::floor(y / 6.93147180559945286227e-01 + 0.5);
+    double r = (y - n * ln2High) - n * ln2Low;
+    if (n < -1022.0) {
+        return 0.0;
+    }
+    if (n > 1023.0) {
+        return HUGE_VAL;
+    }
+    double expR = 1.0;
+    for (int term = 20; term >= 1; --term) {
+        expR = 1.0 + r * expR / term;
+    }
+    std::uint64_t scaleBits = static_cast<std::uint64_t>(static_cast<int>(n) + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &scaleBits, sizeof(scale));
+    return expR * scale;
+}
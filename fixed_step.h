@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// Accumulates wall-clock time in integer nanoseconds and hands it out as a
+// whole number of fixed physics ticks, so the simulation advances the same
+// way whatever the display refresh rate is.
+class FixedStepClock {
+public:
+    FixedStepClock(double tickRate, int maxTicksPerFrame)
+        : tickNanos(static_cast<std::int64_t>(1e9 / tickRate + 0.5)),
+          maxTicks(maxTicksPerFrame),
+          lastNanos(-1),
+          accumulator(0) {}
+
+    // Feed the current time and get the number of ticks to run this frame.
+    // Time beyond maxTicksPerFrame ticks is dropped so a long stall does not
+    // make the next frames spiral trying to catch up.
+    int advance(std::int64_t nowNanos) {
+        if (lastNanos < 0) {
+            lastNanos = nowNanos;
+        }
+        accumulator += nowNanos - lastNanos;
+        lastNanos = nowNanos;
+
+        std::int64_t ticks = accumulator / tickNanos;
+        accumulator -= ticks * tickNanos;
+        if (ticks > maxTicks) {
+            ticks = maxTicks;
+            accumulator = 0;
+        }
+        return static_cast<int>(ticks);
+    }
+
+    // Fraction of a tick left over in the accumulator, for interpolation
+    double alpha() const {
+        return static_cast<double>(accumulator) / static_cast<double>(tickNanos);
+    }
+
+private:
+    std::int64_t tickNanos;
+    std::int64_t maxTicks;
+    std::int64_t lastNanos;
+    std::int64_t accumulator;
+};
+
+// Convert a raw timer reading to nanoseconds without overflowing int64
+inline std::int64_t timerToNanos(std::uint64_t value, std::uint64_t frequency) {
+    std::uint64_t seconds = value / frequency;
+    std::uint64_t remainder = value % frequency;
+    return static_cast<std::int64_t>(seconds * 1000000000ull + remainder * 1000000000ull / frequency);
+}
@@ -0,0 +1,346 @@
+#include "font_helvetica18.h"
+
+// Helvetica 18 bitmaps as shipped with freeglut (X11 font
+// -adobe-helvetica-medium-r-normal--18-180-75-75-p-98-iso8859-1), the font the
+// HUD has always used. Each glyph is fontHeight rows, bottom row first, of
+// (width + 7) / 8 bytes with the leftmost pixel in the high bit.
+
+const FontGlyph fontGlyphs[fontLastChar - fontFirstChar + 1] = {
+    {5, 0}, // ' '
+    {6, 23}, // '!'
+    {5, 46}, // '"'
+    {10, 69}, // '#'
+    {10, 115}, // '$'
+    {16, 161}, // '%'
+    {13, 207}, // '&'
+    {4, 253}, // '\''
+    {6, 276}, // '('
+    {6, 299}, // ')'
+    {7, 322}, // '*'
+    {10, 345}, // '+'
+    {5, 391}, // ','
+    {11, 414}, // '-'
+    {5, 460}, // '.'
+    {5, 483}, // '/'
+    {10, 506}, // '0'
+    {10, 552}, // '1'
+    {10, 598}, // '2'
+    {10, 644}, // '3'
+    {10, 690}, // '4'
+    {10, 736}, // '5'
+    {10, 782}, // '6'
+    {10, 828}, // '7'
+    {10, 874}, // '8'
+    {10, 920}, // '9'
+    {5, 966}, // ':'
+    {5, 989}, // ';'
+    {10, 1012}, // '<'
+    {11, 1058}, // '='
+    {10, 1104}, // '>'
+    {10, 1150}, // '?'
+    {18, 1196}, // '@'
+    {12, 1265}, // 'A'
+    {13, 1311}, // 'B'
+    {14, 1357}, // 'C'
+    {13, 1403}, // 'D'
+    {11, 1449}, // 'E'
+    {11, 1495}, // 'F'
+    {14, 1541}, // 'G'
+    {13, 1587}, // 'H'
+    {6, 1633}, // 'I'
+    {10, 1656}, // 'J'
+    {13, 1702}, // 'K'
+    {10, 1748}, // 'L'
+    {16, 1794}, // 'M'
+    {13, 1840}, // 'N'
+    {15, 1886}, // 'O'
+    {12, 1932}, // 'P'
+    {15, 1978}, // 'Q'
+    {12, 2024}, // 'R'
+    {13, 2070}, // 'S'
+    {12, 2116}, // 'T'
+    {13, 2162}, // 'U'
+    {14, 2208}, // 'V'
+    {18, 2254}, // 'W'
+    {13, 2323}, // 'X'
+    {14, 2369}, // 'Y'
+    {12, 2415}, // 'Z'
+    {5, 2461}, // '['
+    {5, 2484}, // '\\'
+    {5, 2507}, // ']'
+    {9, 2530}, // '^'
+    {10, 2576}, // '_'
+    {4, 2622}, // '`'
+    {9, 2645}, // 'a'
+    {11, 2691}, // 'b'
+    {10, 2737}, // 'c'
+    {11, 2783}, // 'd'
+    {10, 2829}, // 'e'
+    {6, 2875}, // 'f'
+    {11, 2898}, // 'g'
+    {10, 2944}, // 'h'
+    {4, 2990}, // 'i'
+    {4, 3013}, // 'j'
+    {9, 3036}, // 'k'
+    {4, 3082}, // 'l'
+    {14, 3105}, // 'm'
+    {10, 3151}, // 'n'
+    {11, 3197}, // 'o'
+    {11, 3243}, // 'p'
+    {11, 3289}, // 'q'
+    {6, 3335}, // 'r'
+    {9, 3358}, // 's'
+    {6, 3404}, // 't'
+    {10, 3427}, // 'u'
+    {10, 3473}, // 'v'
+    {14, 3519}, // 'w'
+    {10, 3565}, // 'x'
+    {10, 3611}, // 'y'
+    {9, 3657}, // 'z'
+    {6, 3703}, // '{'
+    {4, 3726}, // '|'
+    {6, 3749}, // '}'
+    {10, 3772}, // '~'
+};
+
+const unsigned char fontBitmaps[3818] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00,
+    0x20, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0xd8, 0xd8,
+    0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x24, 0x00, 0x24, 0x00, 0xff, 0x80, 0xff, 0x80, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x7f,
+    0xc0, 0x7f, 0xc0, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x3f,
+    0x80, 0x75, 0xc0, 0x64, 0xc0, 0x04, 0xc0, 0x07, 0x80, 0x1f, 0x00, 0x3c, 0x00, 0x74, 0x00, 0x64,
+    0x00, 0x65, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0x0c, 0x7e, 0x06,
+    0x66, 0x06, 0x66, 0x03, 0x7e, 0x03, 0x3c, 0x01, 0x80, 0x3d, 0x80, 0x7e, 0xc0, 0x66, 0xc0, 0x66,
+    0x60, 0x7e, 0x60, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x38, 0x3f, 0x70, 0x73, 0xe0, 0x61,
+    0xc0, 0x61, 0xe0, 0x63, 0x60, 0x77, 0x60, 0x3e, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3f,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x20, 0x60, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x30, 0x30,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x38, 0x38, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x0c,
+    0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x20, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20,
+    0x30, 0x30, 0x10, 0x10, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x33, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+    0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x33, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x80, 0x7f, 0x80, 0x60, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00,
+    0x03, 0x80, 0x01, 0x80, 0x61, 0x80, 0x7f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x3f, 0x00, 0x63, 0x80, 0x61, 0x80, 0x01, 0x80, 0x03, 0x80, 0x0f, 0x00, 0x0e, 0x00, 0x03, 0x00,
+    0x61, 0x80, 0x61, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x7f, 0xc0, 0x7f, 0xc0, 0x61, 0x80, 0x31, 0x80, 0x19, 0x80, 0x19, 0x80, 0x0d, 0x80,
+    0x07, 0x80, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x80,
+    0x61, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x7f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x71, 0x80, 0x61, 0x80,
+    0x61, 0x80, 0x61, 0x80, 0x7f, 0x00, 0x6e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x31, 0x80, 0x3f, 0x80,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x7f, 0x80, 0x7f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x73, 0x80, 0x61, 0x80, 0x61, 0x80, 0x33, 0x00,
+    0x3f, 0x00, 0x33, 0x00, 0x61, 0x80, 0x61, 0x80, 0x73, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x01, 0x80, 0x01, 0x80, 0x1d, 0x80, 0x3f, 0x80,
+    0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x63, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x20, 0x20, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x07, 0x80, 0x1e, 0x00, 0x38, 0x00, 0x60, 0x00, 0x38, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x80, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x78, 0x00, 0x1e, 0x00,
+    0x07, 0x00, 0x01, 0x80, 0x07, 0x00, 0x1e, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x63, 0x00, 0x63, 0x00,
+    0x7f, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xf0, 0x00, 0x0f, 0xf8, 0x00, 0x1c, 0x00, 0x00, 0x38, 0x00, 0x00, 0x33, 0xb8,
+    0x00, 0x67, 0xfc, 0x00, 0x66, 0x66, 0x00, 0x66, 0x33, 0x00, 0x66, 0x33, 0x00, 0x66, 0x31, 0x80,
+    0x63, 0x19, 0x80, 0x33, 0xb9, 0x80, 0x31, 0xd9, 0x80, 0x18, 0x03, 0x00, 0x0e, 0x07, 0x00, 0x07,
+    0xfe, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0xc0, 0x30, 0x60,
+    0x60, 0x60, 0x60, 0x7f, 0xe0, 0x3f, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x19, 0x80, 0x19, 0x80, 0x0f,
+    0x00, 0x0f, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x7f, 0xe0, 0x60, 0x70, 0x60,
+    0x30, 0x60, 0x30, 0x60, 0x70, 0x7f, 0xe0, 0x7f, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0xe0, 0x7f, 0xc0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0xf0, 0x38, 0x38, 0x30, 0x18, 0x70,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x18, 0x38, 0x38, 0x1f,
+    0xf0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xc0, 0x60, 0xe0, 0x60, 0x60, 0x60, 0x30, 0x60,
+    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x60, 0x60, 0xe0, 0x7f, 0xc0, 0x7f,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xc0, 0x7f, 0xc0, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f,
+    0x80, 0x7f, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0xc0, 0x7f, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0x80, 0x7f,
+    0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0xc0, 0x7f, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xd8, 0x1f, 0xf8, 0x38, 0x38, 0x30, 0x18, 0x70, 0x18, 0x60, 0xf8, 0x60, 0xf8, 0x60, 0x00, 0x60,
+    0x00, 0x70, 0x18, 0x30, 0x18, 0x38, 0x38, 0x1f, 0xf0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x60,
+    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x7f, 0xf0, 0x7f, 0xf0, 0x60, 0x30, 0x60,
+    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x73, 0x80, 0x61, 0x80, 0x61, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x38, 0x60, 0x70, 0x60, 0xe0, 0x61, 0xc0, 0x63, 0x80, 0x67, 0x00, 0x7e, 0x00, 0x7c, 0x00,
+    0x6e, 0x00, 0x67, 0x00, 0x63, 0x80, 0x61, 0xc0, 0x60, 0xe0, 0x60, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80,
+    0x7f, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x86, 0x61, 0x86,
+    0x63, 0xc6, 0x62, 0x46, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x36, 0x6c, 0x36, 0x78, 0x1e, 0x78, 0x1e,
+    0x70, 0x0e, 0x70, 0x0e, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x60, 0x70, 0x60, 0xf0,
+    0x60, 0xf0, 0x61, 0xb0, 0x63, 0x30, 0x63, 0x30, 0x66, 0x30, 0x66, 0x30, 0x6c, 0x30, 0x78, 0x30,
+    0x78, 0x30, 0x70, 0x30, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0xf0, 0x38, 0x38, 0x30, 0x18,
+    0x70, 0x1c, 0x60, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0x70, 0x1c, 0x30, 0x18, 0x38, 0x38,
+    0x1f, 0xf0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x7f, 0x80, 0x7f, 0xc0, 0x60, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0x7f, 0xc0,
+    0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x07, 0xd8, 0x1f, 0xf0, 0x38, 0x78, 0x30, 0xd8, 0x70, 0xdc, 0x60, 0x0c,
+    0x60, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0x70, 0x1c, 0x30, 0x18, 0x38, 0x38, 0x1f, 0xf0, 0x07, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0, 0x60, 0xc0, 0x7f, 0x80,
+    0x7f, 0xc0, 0x60, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0x7f, 0xc0, 0x7f, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0x80, 0x3f, 0xe0, 0x70, 0x70, 0x60, 0x30, 0x00, 0x30, 0x00, 0x70, 0x01, 0xe0, 0x0f, 0x80,
+    0x3e, 0x00, 0x70, 0x00, 0x60, 0x30, 0x70, 0x70, 0x3f, 0xe0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x3f, 0xe0,
+    0x30, 0x60, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30,
+    0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80,
+    0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x60, 0x18, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00,
+    0x0c, 0x0c, 0x00, 0x0e, 0x1c, 0x00, 0x1a, 0x16, 0x00, 0x1b, 0x36, 0x00, 0x1b, 0x36, 0x00, 0x33,
+    0x33, 0x00, 0x33, 0x33, 0x00, 0x31, 0x23, 0x00, 0x31, 0xe3, 0x00, 0x61, 0xe1, 0x80, 0x60, 0xc1,
+    0x80, 0x60, 0xc1, 0x80, 0x60, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x70,
+    0x70, 0x30, 0x60, 0x38, 0xe0, 0x18, 0xc0, 0x0d, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0d, 0x80, 0x18,
+    0xc0, 0x38, 0xe0, 0x30, 0x60, 0x70, 0x70, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x80, 0x0c, 0xc0, 0x18, 0x60, 0x18, 0x60, 0x30,
+    0x30, 0x30, 0x30, 0x60, 0x18, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x60, 0x00, 0x30,
+    0x00, 0x18, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xc0, 0x00,
+    0x60, 0x7f, 0xe0, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10, 0x30, 0x30, 0x20,
+    0x20, 0x60, 0x60, 0x40, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x63, 0x00,
+    0x36, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x40, 0x40,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x77, 0x00, 0x63, 0x00, 0x63, 0x00, 0x73, 0x00, 0x3f, 0x00, 0x07, 0x00, 0x63, 0x00, 0x77,
+    0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x7f,
+    0x80, 0x71, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x71, 0x80, 0x7f, 0x80, 0x6f,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x80, 0x31,
+    0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x31, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xc0, 0x3f, 0xc0, 0x31, 0xc0, 0x60,
+    0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x31, 0xc0, 0x3f, 0xc0, 0x1e, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x80, 0x71, 0x80, 0x60, 0x00, 0x60,
+    0x00, 0x7f, 0x80, 0x61, 0x80, 0x61, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x3c, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x3f, 0x80, 0x31, 0x80, 0x00, 0xc0, 0x1e, 0xc0, 0x3f, 0xc0,
+    0x31, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x30, 0xc0, 0x3f, 0xc0, 0x1e, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+    0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x71, 0x80, 0x6f, 0x80, 0x67, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x60,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x80, 0x63, 0x00, 0x67, 0x00, 0x66, 0x00, 0x6c, 0x00,
+    0x7c, 0x00, 0x78, 0x00, 0x6c, 0x00, 0x66, 0x00, 0x63, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0x63, 0x18, 0x63,
+    0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x73, 0x98, 0x6f, 0x78, 0x66, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61,
+    0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x71, 0x80, 0x6f, 0x80, 0x67, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x80, 0x31, 0x80, 0x60, 0xc0, 0x60,
+    0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x31, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0x80, 0x71, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60,
+    0xc0, 0x60, 0xc0, 0x71, 0x80, 0x7f, 0x80, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x1e, 0xc0, 0x3f, 0xc0, 0x31, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60,
+    0xc0, 0x31, 0xc0, 0x3f, 0xc0, 0x1e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x70, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x7e, 0x00, 0x63, 0x00, 0x03, 0x00,
+    0x1f, 0x00, 0x7e, 0x00, 0x60, 0x00, 0x63, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x80, 0x7d,
+    0x80, 0x63, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e,
+    0x00, 0x12, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x0c, 0xc0, 0x1c, 0xe0, 0x14,
+    0xa0, 0x34, 0xb0, 0x33, 0x30, 0x33, 0x30, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00, 0x1e, 0x00, 0x0c,
+    0x00, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x73, 0x80, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38,
+    0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x12, 0x00, 0x33, 0x00, 0x33,
+    0x00, 0x33, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x06,
+    0x00, 0x03, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x60, 0xc0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0c,
+    0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00,
+    0x3f, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+// Bitmap font used by the HUD, covering printable ASCII
+const int fontFirstChar = 32;
+const int fontLastChar = 126;
+const int fontHeight = 23; // Rows per glyph
+const int fontBaseline = 5; // Rows below the baseline
+
+struct FontGlyph {
+    int width; // Pixels, also the advance to the next glyph
+    int offset; // First byte of the glyph in fontBitmaps
+};
+
+extern const FontGlyph fontGlyphs[fontLastChar - fontFirstChar + 1];
+extern const unsigned char fontBitmaps[3818];
@@ -0,0 +1,115 @@
+#include "frame_profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+const char* phaseNames[profilePhaseCount] = {
+    "input",
+    "update_ball",
+    "update_bottles",
+    "handle_collisions",
+    "render",
+    "swap_buffers",
+};
+
+}
+
+const char* profilePhaseName(ProfilePhase phase) {
+    return phaseNames[static_cast<int>(phase)];
+}
+
+FrameProfiler*& activeProfiler() {
+    static thread_local FrameProfiler* profiler = nullptr;
+    return profiler;
+}
+
+FrameProfiler::FrameProfiler() : frames(), next(0), count(0), frameStart(0), current() {}
+
+void FrameProfiler::beginFrame() {
+#ifdef BOWLING_PROFILE
+    std::fill(current, current + profilePhaseCount, 0);
+    frameStart = profilerNow();
+#endif
+}
+
+void FrameProfiler::endFrame() {
+#ifdef BOWLING_PROFILE
+    Frame& frame = frames[next];
+    for (int phase = 0; phase < profilePhaseCount; ++phase) {
+        frame.phaseMs[phase] = static_cast<float>(current[phase] * 1e-6);
+    }
+    frame.totalMs = static_cast<float>((profilerNow() - frameStart) * 1e-6);
+    next = (next + 1) % historyFrames;
+    count = std::min(count + 1, historyFrames);
+#endif
+}
+
+void FrameProfiler::add(ProfilePhase phase, std::int64_t nanos) {
+    current[static_cast<int>(phase)] += nanos;
+}
+
+int FrameProfiler::frameCount() const {
+    return count;
+}
+
+const FrameProfiler::Frame& FrameProfiler::recorded(int frame) const {
+    return frames[(next - count + frame + historyFrames) % historyFrames];
+}
+
+float FrameProfiler::phaseMs(int frame, ProfilePhase phase) const {
+    return recorded(frame).phaseMs[static_cast<int>(phase)];
+}
+
+float FrameProfiler::frameMs(int frame) const {
+    return recorded(frame).totalMs;
+}
+
+FrameProfiler::Stats FrameProfiler::phaseStats(ProfilePhase phase) const {
+    return computeStats(static_cast<int>(phase));
+}
+
+FrameProfiler::Stats FrameProfiler::frameStats() const {
+    return computeStats(profilePhaseCount);
+}
+
+// Column profilePhaseCount is the whole frame
+FrameProfiler::Stats FrameProfiler::computeStats(int column) const {
+    if (count == 0) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    float values[historyFrames];
+    double sum = 0.0;
+    for (int frame = 0; frame < count; ++frame) {
+        const Frame& recordedFrame = recorded(frame);
+        values[frame] = column < profilePhaseCount ? recordedFrame.phaseMs[column] : recordedFrame.totalMs;
+        sum += values[frame];
+    }
+    int p99 = std::min(count - 1, (count * 99) / 100);
+    std::nth_element(values, values + p99, values + count);
+    float p99Ms = values[p99];
+    float minMs = *std::min_element(values, values + count);
+    return {minMs, static_cast<float>(sum / count), p99Ms};
+}
+
+bool FrameProfiler::writeCsv(const char* path) const {
+    std::FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "frame");
+    for (int phase = 0; phase < profilePhaseCount; ++phase) {
+        std::fprintf(file, ",%s_ms", phaseNames[phase]);
+    }
+    std::fprintf(file, ",frame_ms\n");
+    for (int frame = 0; frame < count; ++frame) {
+        const Frame& recordedFrame = recorded(frame);
+        std::fprintf(file, "%d", frame);
+        for (int phase = 0; phase < profilePhaseCount; ++phase) {
+            std::fprintf(file, ",%.4f", recordedFrame.phaseMs[phase]);
+        }
+        std::fprintf(file, ",%.4f\n", recordedFrame.totalMs);
+    }
+    return std::fclose(file) == 0;
+}
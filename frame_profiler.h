@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+
+#include "trace.h"
+
+// Parts of a frame that get timed
+enum class ProfilePhase {
+    Input,
+    UpdateBall,
+    UpdateBottles,
+    HandleCollisions,
+    Render,
+    SwapBuffers,
+    Count
+};
+
+const int profilePhaseCount = static_cast<int>(ProfilePhase::Count);
+
+const char* profilePhaseName(ProfilePhase phase);
+
+// Per-phase frame times for the last historyFrames frames. Phases that run
+// several times per frame (physics ticks) are summed into one entry. Without
+// BOWLING_PROFILE nothing is recorded and frameCount() stays 0.
+class FrameProfiler {
+public:
+    static constexpr int historyFrames = 1024;
+
+    struct Stats {
+        float minMs, avgMs, p99Ms;
+    };
+
+    FrameProfiler();
+
+    void beginFrame();
+    void endFrame();
+    void add(ProfilePhase phase, std::int64_t nanos);
+
+    // Recorded frames, up to historyFrames
+    int frameCount() const;
+    // Phase time of a recorded frame, 0 being the oldest
+    float phaseMs(int frame, ProfilePhase phase) const;
+    float frameMs(int frame) const;
+
+    Stats phaseStats(ProfilePhase phase) const;
+    Stats frameStats() const;
+
+    // Write every recorded frame as CSV, one row per frame
+    bool writeCsv(const char* path) const;
+
+private:
+    struct Frame {
+        float phaseMs[profilePhaseCount];
+        float totalMs;
+    };
+
+    Stats computeStats(int column) const;
+    const Frame& recorded(int frame) const;
+
+    Frame frames[historyFrames];
+    int next;
+    int count;
+    std::int64_t frameStart;
+    std::int64_t current[profilePhaseCount];
+};
+
+// Nanoseconds on the tracing clock
+inline std::int64_t profilerNow() {
+    return traceNow();
+}
+
+// Profiler that timers on the calling thread report to, or null. Only the
+// game loop installs one, so simulations on worker threads skip timing.
+FrameProfiler*& activeProfiler();
+
+// Adds the time from construction to destruction to a phase of the active
+// profiler, and to the trace when tracing. Threads without a profiler (batch
+// workers) skip per-phase timing entirely.
+class ScopedPhaseTimer {
+public:
+    explicit ScopedPhaseTimer(ProfilePhase phase)
+        : profiler(activeProfiler()), phase(phase), start(profiler ? profilerNow() : 0) {}
+
+    ~ScopedPhaseTimer() {
+        if (profiler) {
+            std::int64_t end = profilerNow();
+            profiler->add(phase, end - start);
+            if (traceEnabled()) {
+                recordTraceSpan(profilePhaseName(phase), start, end);
+            }
+        }
+    }
+
+private:
+    FrameProfiler* profiler;
+    ProfilePhase phase;
+    std::int64_t start;
+};
+
+// Time the rest of the enclosing scope. Compiles to nothing without BOWLING_PROFILE.
+#ifdef BOWLING_PROFILE
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_PHASE(phase) ScopedPhaseTimer PROFILE_CONCAT(phaseTimer, __LINE__)(phase)
+#else
+#define PROFILE_PHASE(phase) ((void)0)
+#endif
@@ -0,0 +1,87 @@
+#include "gl_functions.h"
+
+#include <cstdio>
+
+namespace {
+
+template <typename Function>
+bool load(Function& function, const char* name) {
+    function = reinterpret_cast<Function>(glfwGetProcAddress(name));
+    return function != nullptr;
+}
+
+GLuint compileShader(const GlFunctions& gl, GLenum type, const char* source) {
+    GLuint shader = gl.createShader(type);
+    gl.shaderSource(shader, 1, &source, nullptr);
+    gl.compileShader(shader);
+    GLint compiled = 0;
+    gl.getShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        char log[1024];
+        gl.getShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::fprintf(stderr, "Shader compilation failed: %s\n", log);
+        gl.deleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+}
+
+bool loadGlFunctions(GlFunctions& gl) {
+    bool loaded = true;
+    loaded &= load(gl.genVertexArrays, "glGenVertexArrays");
+    loaded &= load(gl.bindVertexArray, "glBindVertexArray");
+    loaded &= load(gl.genBuffers, "glGenBuffers");
+    loaded &= load(gl.bindBuffer, "glBindBuffer");
+    loaded &= load(gl.bufferData, "glBufferData");
+    loaded &= load(gl.bufferSubData, "glBufferSubData");
+    loaded &= load(gl.enableVertexAttribArray, "glEnableVertexAttribArray");
+    loaded &= load(gl.vertexAttribPointer, "glVertexAttribPointer");
+    loaded &= load(gl.vertexAttribDivisor, "glVertexAttribDivisor");
+    loaded &= load(gl.createShader, "glCreateShader");
+    loaded &= load(gl.shaderSource, "glShaderSource");
+    loaded &= load(gl.compileShader, "glCompileShader");
+    loaded &= load(gl.getShaderiv, "glGetShaderiv");
+    loaded &= load(gl.getShaderInfoLog, "glGetShaderInfoLog");
+    loaded &= load(gl.deleteShader, "glDeleteShader");
+    loaded &= load(gl.createProgram, "glCreateProgram");
+    loaded &= load(gl.attachShader, "glAttachShader");
+    loaded &= load(gl.linkProgram, "glLinkProgram");
+    loaded &= load(gl.getProgramiv, "glGetProgramiv");
+    loaded &= load(gl.getProgramInfoLog, "glGetProgramInfoLog");
+    loaded &= load(gl.useProgram, "glUseProgram");
+    loaded &= load(gl.drawArraysInstanced, "glDrawArraysInstanced");
+    return loaded;
+}
+
+GLuint buildShaderProgram(const GlFunctions& gl, const char* vertexSource, const char* fragmentSource) {
+    GLuint vertexShader = compileShader(gl, GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = compileShader(gl, GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vertexShader || !fragmentShader) {
+        if (vertexShader) {
+            gl.deleteShader(vertexShader);
+        }
+        if (fragmentShader) {
+            gl.deleteShader(fragmentShader);
+        }
+        return 0;
+    }
+
+    GLuint program = gl.createProgram();
+    gl.attachShader(program, vertexShader);
+    gl.attachShader(program, fragmentShader);
+    gl.linkProgram(program);
+    gl.deleteShader(vertexShader);
+    gl.deleteShader(fragmentShader);
+
+    GLint linked = 0;
+    gl.getProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char log[1024];
+        gl.getProgramInfoLog(program, sizeof(log), nullptr, log);
+        std::fprintf(stderr, "Shader link failed: %s\n", log);
+        return 0;
+    }
+    return program;
+}
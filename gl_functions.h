@@ -0,0 +1,69 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <cstddef>
+
+// The platform GL headers only promise OpenGL 1.1, so the 3.3 entry points
+// used by the batched renderers are looked up at runtime.
+
+#if defined(_WIN32)
+#define BOWLING_GL_CALL __stdcall
+#else
+#define BOWLING_GL_CALL
+#endif
+
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+#ifndef GL_STATIC_DRAW
+#define GL_STATIC_DRAW 0x88E4
+#endif
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_VERTEX_SHADER 0x8B31
+#endif
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS 0x8B82
+#endif
+
+struct GlFunctions {
+    void (BOWLING_GL_CALL* genVertexArrays)(GLsizei n, GLuint* arrays);
+    void (BOWLING_GL_CALL* bindVertexArray)(GLuint array);
+    void (BOWLING_GL_CALL* genBuffers)(GLsizei n, GLuint* buffers);
+    void (BOWLING_GL_CALL* bindBuffer)(GLenum target, GLuint buffer);
+    void (BOWLING_GL_CALL* bufferData)(GLenum target, std::ptrdiff_t size, const void* data, GLenum usage);
+    void (BOWLING_GL_CALL* bufferSubData)(GLenum target, std::ptrdiff_t offset, std::ptrdiff_t size, const void* data);
+    void (BOWLING_GL_CALL* enableVertexAttribArray)(GLuint index);
+    void (BOWLING_GL_CALL* vertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                                GLsizei stride, const void* pointer);
+    void (BOWLING_GL_CALL* vertexAttribDivisor)(GLuint index, GLuint divisor);
+    GLuint (BOWLING_GL_CALL* createShader)(GLenum type);
+    void (BOWLING_GL_CALL* shaderSource)(GLuint shader, GLsizei count, const char* const* source, const GLint* length);
+    void (BOWLING_GL_CALL* compileShader)(GLuint shader);
+    void (BOWLING_GL_CALL* getShaderiv)(GLuint shader, GLenum name, GLint* value);
+    void (BOWLING_GL_CALL* getShaderInfoLog)(GLuint shader, GLsizei size, GLsizei* length, char* log);
+    void (BOWLING_GL_CALL* deleteShader)(GLuint shader);
+    GLuint (BOWLING_GL_CALL* createProgram)();
+    void (BOWLING_GL_CALL* attachShader)(GLuint program, GLuint shader);
+    void (BOWLING_GL_CALL* linkProgram)(GLuint program);
+    void (BOWLING_GL_CALL* getProgramiv)(GLuint program, GLenum name, GLint* value);
+    void (BOWLING_GL_CALL* getProgramInfoLog)(GLuint program, GLsizei size, GLsizei* length, char* log);
+    void (BOWLING_GL_CALL* useProgram)(GLuint program);
+    void (BOWLING_GL_CALL* drawArraysInstanced)(GLenum mode, GLint first, GLsizei count, GLsizei instances);
+};
+
+// Load every entry point from the current context. Returns false if any is
+// missing, in which case the caller should stay on the fixed-function path.
+bool loadGlFunctions(GlFunctions& gl);
+
+// Compile and link a vertex/fragment shader pair, printing the log on failure.
+// Returns 0 if either stage fails.
+GLuint buildShaderProgram(const GlFunctions& gl, const char* vertexSource, const char* fragmentSource);
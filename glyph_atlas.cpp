@@ -0,0 +1,61 @@
+#include "glyph_atlas.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "font_helvetica18.h"
+
+void bakeGlyphAtlas(std::uint8_t* pixels) {
+    std::memset(pixels, 0, atlasWidth * atlasHeight);
+    for (int c = fontFirstChar; c <= fontLastChar; ++c) {
+        int cell = c - fontFirstChar;
+        int cellX = (cell % atlasColumns) * atlasCellSize;
+        int cellY = (cell / atlasColumns) * atlasCellSize;
+        const FontGlyph& glyph = fontGlyphs[cell];
+        int bytesPerRow = (glyph.width + 7) / 8;
+        for (int row = 0; row < fontHeight; ++row) {
+            const unsigned char* bits = fontBitmaps + glyph.offset + row * bytesPerRow;
+            for (int column = 0; column < glyph.width; ++column) {
+                if (bits[column / 8] & (0x80 >> (column % 8))) {
+                    pixels[(cellY + row) * atlasWidth + cellX + column] = 255;
+                }
+            }
+        }
+    }
+}
+
+void appendTextVertices(float x, float y, const char* text, std::size_t length, Color color,
+                        int framebufferWidth, int framebufferHeight, std::vector<TextVertex>& vertices) {
+    // Snap the pen to a whole pixel so glyphs sample the atlas texel for texel
+    float pixelWidth = 2.0f / framebufferWidth;
+    float pixelHeight = 2.0f / framebufferHeight;
+    float penX = std::floor((x + 1.0f) / pixelWidth + 0.5f);
+    float penY = std::floor((y + 1.0f) / pixelHeight + 0.5f) - fontBaseline;
+
+    for (std::size_t i = 0; i < length; ++i) {
+        int c = static_cast<unsigned char>(text[i]);
+        if (c < fontFirstChar || c > fontLastChar) {
+            continue;
+        }
+        int cell = c - fontFirstChar;
+        const FontGlyph& glyph = fontGlyphs[cell];
+        if (c != ' ') {
+            float left = penX * pixelWidth - 1.0f;
+            float right = (penX + glyph.width) * pixelWidth - 1.0f;
+            float bottom = penY * pixelHeight - 1.0f;
+            float top = (penY + fontHeight) * pixelHeight - 1.0f;
+            float u0 = static_cast<float>((cell % atlasColumns) * atlasCellSize) / atlasWidth;
+            float u1 = u0 + static_cast<float>(glyph.width) / atlasWidth;
+            float v0 = static_cast<float>((cell / atlasColumns) * atlasCellSize) / atlasHeight;
+            float v1 = v0 + static_cast<float>(fontHeight) / atlasHeight;
+
+            vertices.push_back({left, bottom, u0, v0, color});
+            vertices.push_back({right, bottom, u1, v0, color});
+            vertices.push_back({right, top, u1, v1, color});
+            vertices.push_back({left, bottom, u0, v0, color});
+            vertices.push_back({right, top, u1, v1, color});
+            vertices.push_back({left, top, u0, v1, color});
+        }
+        penX += glyph.width;
+    }
+}
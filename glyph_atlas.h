@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "render_prep.h"
+
+// Every printable glyph baked into one single-channel texture, 16 cells
+// across and 6 down
+const int atlasCellSize = 24;
+const int atlasColumns = 16;
+const int atlasWidth = atlasCellSize * atlasColumns;
+const int atlasHeight = atlasCellSize * 6;
+
+// Fill pixels (atlasWidth * atlasHeight bytes, bottom row first) with glyph
+// coverage, 255 where a glyph pixel is set
+void bakeGlyphAtlas(std::uint8_t* pixels);
+
+// One corner of a glyph quad: normalized device position, atlas texture
+// coordinate and colour
+struct TextVertex {
+    float x, y;
+    float u, v;
+    Color color;
+};
+
+// Lay out text the way glRasterPos + glutBitmapCharacter did: (x, y) in
+// normalized device coordinates is the left end of the baseline, and glyphs
+// are drawn at their native pixel size for the given framebuffer. Appends two
+// triangles per visible glyph.
+void appendTextVertices(float x, float y, const char* text, std::size_t length, Color color,
+                        int framebufferWidth, int framebufferHeight, std::vector<TextVertex>& vertices);
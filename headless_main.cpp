@@ -0,0 +1,12 @@
+#include "headless_modes.h"
+
+// Entry point for machines without a display: the same headless modes as the
+// game, without linking GLFW or OpenGL
+int main(int argc, char** argv) {
+    int exitCode = 0;
+    if (runHeadlessMode(argc, argv, exitCode)) {
+        return exitCode;
+    }
+    printHeadlessUsage();
+    return 1;
+}
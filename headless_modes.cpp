@@ -0,0 +1,322 @@
+#include "headless_modes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "level_library.h"
+#include "optimizer.h"
+#include "replay.h"
+#include "replay_archive.h"
+#include "thread_pool.h"
+#include "tournament_server.h"
+#include "trace.h"
+
+namespace {
+
+// --trace FILE, for the modes that record a timeline
+const char* traceOption(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--trace") == 0) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+void beginTrace(const char* tracePath) {
+    if (tracePath) {
+        setTraceThreadName("main");
+        startTracing();
+    }
+}
+
+// Write the trace started by beginTrace, if any. Returns false if it could not be written.
+bool finishTrace(const char* tracePath) {
+    if (tracePath && !writeTrace(tracePath)) {
+        std::fprintf(stderr, "Could not write the trace to %s\n", tracePath);
+        return false;
+    }
+    return true;
+}
+
+int runOptimizer(int argc, char** argv) {
+    OptimizerSettings settings;
+    int threads = 0;
+    const char* levelsPath = nullptr;
+    const char* levelName = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            break;
+        }
+        if (std::strcmp(argv[i], "--threads") == 0) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--positions") == 0) {
+            settings.positions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--powers") == 0) {
+            settings.powers = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--samples") == 0) {
+            settings.samplesPerAim = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            settings.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0) {
+            settings.tickRate = std::max(1.0, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--stress-rack") == 0) {
+            settings.stressPins = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--levels") == 0) {
+            levelsPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--level") == 0) {
+            levelName = argv[++i];
+        }
+    }
+    // Throw on the named level, or the file's first
+    std::vector<Level> levels;
+    if (levelsPath) {
+        if (!loadLevels(levelsPath, levelName, levels)) {
+            return 1;
+        }
+        settings.level = levels[0];
+    }
+
+    const char* tracePath = traceOption(argc, argv);
+    beginTrace(tracePath);
+
+    ThreadPool pool(threads);
+    auto start = std::chrono::steady_clock::now();
+    OptimizerResult result = optimizeThrow(settings, pool);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("Best throw: x=%.4f power=%.2f expected toppled %.3f\n",
+                result.best.aim.x, result.best.aim.power, result.best.expectedToppled);
+    std::printf("Toppled distribution over %d samples:\n", settings.samplesPerAim);
+    for (std::size_t toppled = 0; toppled < result.bestDistribution.size(); ++toppled) {
+        int count = result.bestDistribution[toppled];
+        if (count > 0 || result.bestDistribution.size() <= 11) {
+            std::printf("  %3zu: %5.1f%%\n", toppled, 100.0 * count / settings.samplesPerAim);
+        }
+    }
+    std::printf("Evaluated %zu throws on %d threads in %.2f s (%.0f throws/s)\n",
+                result.throwsEvaluated, pool.size(), seconds, result.throwsEvaluated / std::max(seconds, 1e-9));
+    return finishTrace(tracePath) ? 0 : 1;
+}
+
+// Re-simulate a replay as fast as possible and check it against the recording.
+// The trace, if any, has a span per second of play.
+int runReplay(const char* path, const char* tracePath) {
+    Replay replay;
+    const char* error = nullptr;
+    if (!readReplay(path, replay, error)) {
+        std::fprintf(stderr, "%s: %s\n", path, error);
+        return 1;
+    }
+    ReplayPlayer player(replay);
+    if (!player.rackMatches()) {
+        std::fprintf(stderr, "%s: recorded on a different rack than this build sets up\n", path);
+        return 1;
+    }
+
+    beginTrace(tracePath);
+    std::uint32_t ticksPerSecond = static_cast<std::uint32_t>(std::max(1.0, replay.tickRate));
+    auto start = std::chrono::steady_clock::now();
+    while (!player.finished()) {
+        TRACE_SPAN("replay_second");
+        player.advance(ticksPerSecond);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("Replayed %u ticks (%.1f s of play) in %.2f ms, %.0fx real time\n", replay.ticks,
+                replay.ticks / replay.tickRate, seconds * 1000.0, replay.ticks / replay.tickRate / std::max(seconds, 1e-9));
+    std::printf("Score %d, recorded %d: %s\n", player.simulation.totalToppled(), replay.score,
+                player.verified() ? "verified" : "MISMATCH");
+    if (!finishTrace(tracePath)) {
+        return 1;
+    }
+    return player.verified() ? 0 : 2;
+}
+
+// Pack replays into an archive: --pack ARCHIVE REPLAY... [--keyframe-seconds S]
+int runPack(int argc, char** argv, int packIndex) {
+    const char* archivePath = argv[packIndex + 1];
+    double keyframeSeconds = 5.0;
+    std::vector<const char*> replayPaths;
+    for (int i = packIndex + 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--keyframe-seconds") == 0 && i + 1 < argc) {
+            keyframeSeconds = std::max(0.01, std::atof(argv[++i]));
+        } else if (argv[i][0] != '-') {
+            replayPaths.push_back(argv[i]);
+        }
+    }
+
+    ReplayArchiveWriter writer;
+    if (!writer.open(archivePath)) {
+        std::fprintf(stderr, "Could not create %s\n", archivePath);
+        return 1;
+    }
+    int packed = 0;
+    Replay replay;
+    for (const char* path : replayPaths) {
+        const char* error = nullptr;
+        std::uint32_t interval = 0;
+        if (readReplay(path, replay, error)) {
+            interval = static_cast<std::uint32_t>(std::max(1.0, keyframeSeconds * replay.tickRate));
+        }
+        if (!error && writer.add(replay, interval, error)) {
+            packed++;
+        } else {
+            std::fprintf(stderr, "Skipping %s: %s\n", path, error);
+        }
+    }
+    if (!writer.finish()) {
+        std::fprintf(stderr, "Could not write %s\n", archivePath);
+        return 1;
+    }
+    std::printf("Packed %d of %zu replays into %s\n", packed, replayPaths.size(), archivePath);
+    return packed == static_cast<int>(replayPaths.size()) ? 0 : 2;
+}
+
+// Show a game's state at a tick: --seek ARCHIVE GAME TICK
+int runSeek(const char* archivePath, std::size_t game, std::uint32_t tick) {
+    ReplayArchive archive;
+    const char* error = nullptr;
+    if (!archive.open(archivePath, error)) {
+        std::fprintf(stderr, "%s: %s\n", archivePath, error);
+        return 1;
+    }
+    ArchiveCursor cursor;
+    auto start = std::chrono::steady_clock::now();
+    if (!archive.seek(game, tick, cursor, error)) {
+        std::fprintf(stderr, "%s game %zu: %s\n", archivePath, game, error);
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const Simulation& simulation = cursor.simulation;
+    std::printf("Game %zu of %zu, tick %u (%.2f s): throws %d, toppled %d, pins %03x, ball (%.3f, %.3f)%s\n", game,
+                archive.size(), cursor.currentTick(), cursor.currentTick() * simulation.tickSeconds, simulation.throws,
+                simulation.totalToppled(), static_cast<unsigned>(simulation.bottles.rack().pinMask), simulation.ball.x,
+                simulation.ball.y, simulation.gameOver ? ", game over" : "");
+    std::printf("State hash %016llx, sought in %.3f ms\n", static_cast<unsigned long long>(simulationHash(simulation)),
+                seconds * 1000.0);
+    return 0;
+}
+
+// Index a level file and load every level, as a check before using it
+int runListLevels(const char* path) {
+    LevelLibrary library;
+    const char* error = nullptr;
+    std::size_t line = 0;
+    auto start = std::chrono::steady_clock::now();
+    if (!library.open(path, error, line)) {
+        std::fprintf(stderr, "%s:%zu: %s\n", path, line, error);
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Level level;
+    for (std::size_t index = 0; index < library.size(); ++index) {
+        if (!library.load(index, level, error, line)) {
+            std::fprintf(stderr, "%s:%zu: %s\n", path, line, error);
+            return 1;
+        }
+        std::printf("%-20s lane %.3f to %.3f, %s rack of %zu pins\n", level.name.c_str(), level.tuning.laneLeftEdge,
+                    level.tuning.laneRightEdge, level.pins.empty() ? "standard" : "custom",
+                    level.pins.empty() ? StandardRack::pinCount : level.pins.size());
+    }
+    std::printf("%zu levels, indexed in %.3f ms\n", library.size(), seconds * 1000.0);
+    return 0;
+}
+
+int runServer(int argc, char** argv) {
+    TournamentSettings settings;
+    const char* levelsPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            break;
+        }
+        if (std::strcmp(argv[i], "--socket") == 0) {
+            settings.socketPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            settings.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--batch-ticks") == 0) {
+            settings.batchTicks = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0) {
+            settings.tickRate = std::max(1.0, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--stress-rack") == 0) {
+            settings.stressPins = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--levels") == 0) {
+            levelsPath = argv[++i];
+        }
+    }
+    if (levelsPath && !loadLevels(levelsPath, nullptr, settings.levels)) {
+        return 1;
+    }
+    const char* tracePath = traceOption(argc, argv);
+    beginTrace(tracePath);
+    int exitCode = runTournamentServer(settings);
+    return finishTrace(tracePath) ? exitCode : 1;
+}
+
+}
+
+bool runHeadlessMode(int argc, char** argv, int& exitCode) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--optimize") == 0) {
+            exitCode = runOptimizer(argc, argv);
+            return true;
+        }
+        if (std::strcmp(argv[i], "--verify") == 0 && i + 1 < argc) {
+            exitCode = runReplay(argv[i + 1], traceOption(argc, argv));
+            return true;
+        }
+        if (std::strcmp(argv[i], "--pack") == 0 && i + 1 < argc) {
+            exitCode = runPack(argc, argv, i);
+            return true;
+        }
+        if (std::strcmp(argv[i], "--seek") == 0 && i + 3 < argc) {
+            exitCode = runSeek(argv[i + 1], std::strtoull(argv[i + 2], nullptr, 10),
+                               static_cast<std::uint32_t>(std::strtoul(argv[i + 3], nullptr, 10)));
+            return true;
+        }
+        if (std::strcmp(argv[i], "--list-levels") == 0 && i + 1 < argc) {
+            exitCode = runListLevels(argv[i + 1]);
+            return true;
+        }
+        if (std::strcmp(argv[i], "--serve") == 0) {
+            exitCode = runServer(argc, argv);
+            return true;
+        }
+    }
+    return false;
+}
+
+void printHeadlessUsage() {
+    std::printf("Headless modes:\n"
+                "  --optimize    Search for the throw with the highest expected pinfall\n"
+                "      --threads N       Worker threads (default: one per hardware thread)\n"
+                "      --positions N     Aim points across the lane (default 41)\n"
+                "      --powers N        Power levels from 0 to 10 (default 21)\n"
+                "      --samples N       Noisy throws per aim point (default 64)\n"
+                "      --seed N          Random seed (default 1)\n"
+                "      --level NAME      Level to throw on, from --levels (default: the first)\n"
+                "  --verify FILE Re-simulate a replay at full speed and check it bit for bit\n"
+                "  --pack ARCHIVE REPLAY...\n"
+                "                Pack replays into a seekable archive\n"
+                "      --keyframe-seconds S  Time between keyframes (default 5)\n"
+                "  --seek ARCHIVE GAME TICK\n"
+                "                Show a game's state at a tick, from the nearest keyframe\n"
+                "  --list-levels FILE\n"
+                "                Check a level file and list its levels\n"
+                "  --serve       Host lanes for bot clients on a Unix socket (Linux only)\n"
+                "      --socket PATH     Socket to listen on (default bowling.sock)\n"
+                "      --threads N       Worker threads (default: one per hardware thread)\n"
+                "      --batch-ticks N   Ticks per lane between socket polls (default 64)\n"
+                "  Options for --optimize and --serve:\n"
+                "      --tick-rate HZ    Physics tick rate (default 120)\n"
+                "      --stress-rack N   Replace the rack with N bottles\n"
+                "      --levels FILE     Level file to take lanes and racks from\n"
+                "  Options for --optimize, --verify and --serve:\n"
+                "      --trace FILE      Write a Chrome trace-event timeline to FILE\n");
+}
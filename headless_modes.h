@@ -0,0 +1,11 @@
+#pragma once
+
+// Command-line modes that run without a window: shared by the game, which
+// checks for them before touching GLFW, and by bowling_headless.
+//
+// Runs the mode argv asks for and sets exitCode. Returns false if argv does
+// not select a headless mode.
+bool runHeadlessMode(int argc, char** argv, int& exitCode);
+
+// Print the headless modes and their options
+void printHeadlessUsage();
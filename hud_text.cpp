@@ -0,0 +1,49 @@
+#include "hud_text.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+HudLine::HudLine(const char* prefix, const char* suffix)
+    : textLength(0),
+      prefixLength(std::min(std::strlen(prefix), capacity / 2)),
+      suffix(suffix),
+      hasValue(false),
+      isFloat(false),
+      lastValue(0.0f),
+      lastInt(0) {
+    std::memcpy(buffer, prefix, prefixLength);
+    finish(buffer + prefixLength);
+}
+
+void HudLine::set(int value) {
+    if (hasValue && !isFloat && value == lastInt) {
+        return;
+    }
+    hasValue = true;
+    isFloat = false;
+    lastInt = value;
+    std::to_chars_result result = std::to_chars(buffer + prefixLength, buffer + capacity, value);
+    finish(result.ptr);
+}
+
+void HudLine::set(float value) {
+    if (hasValue && isFloat && value == lastValue) {
+        return;
+    }
+    hasValue = true;
+    isFloat = true;
+    lastValue = value;
+    std::to_chars_result result = std::to_chars(buffer + prefixLength, buffer + capacity, value,
+                                                std::chars_format::fixed, 6);
+    finish(result.ec == std::errc() ? result.ptr : buffer + prefixLength);
+}
+
+// Append the suffix after the number ending at end and terminate the text
+void HudLine::finish(char* end) {
+    std::size_t available = buffer + capacity - 1 - end;
+    std::size_t suffixLength = std::min(std::strlen(suffix), available);
+    std::memcpy(end, suffix, suffixLength);
+    end[suffixLength] = '\0';
+    textLength = end + suffixLength - buffer;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+// One line of HUD text: a fixed prefix and suffix around a number. The text
+// lives in a fixed buffer and is only re-formatted when the number changes,
+// so drawing it every frame never touches the heap.
+class HudLine {
+public:
+    HudLine(const char* prefix, const char* suffix = "");
+
+    // Integers print plainly; floats print like std::to_string (six decimals)
+    void set(int value);
+    void set(float value);
+
+    const char* text() const { return buffer; }
+    std::size_t length() const { return textLength; }
+
+private:
+    void finish(char* end);
+
+    static constexpr std::size_t capacity = 64;
+    char buffer[capacity];
+    std::size_t textLength;
+    std::size_t prefixLength;
+    const char* suffix;
+    bool hasValue;
+    bool isFloat;
+    float lastValue;
+    int lastInt;
+};
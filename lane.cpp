@@ -0,0 +1,104 @@
+#include "lane.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "thread_pool.h"
+#include "trace.h"
+
+namespace {
+
+const float botMinPower = 3.0f;
+const float botMaxPower = 10.0f;
+const float botMaxWait = 1.5f; // Seconds a bot may idle before lining up a throw
+const float botRestartWait = 2.0f; // Seconds a bot looks at the final score
+const std::size_t lanesPerRange = 1;
+
+}
+
+LaneBot::LaneBot(std::uint64_t seed)
+    : random{seed}, planned(false), sawGameOver(false), targetX(0.0f), targetPower(0.0f), waitSeconds(0.0f) {}
+
+InputState LaneBot::nextInput(const Simulation& simulation) {
+    InputState input = {};
+    if (waitSeconds > 0.0f) {
+        waitSeconds -= simulation.tickSeconds;
+        return input;
+    }
+    if (simulation.gameOver) {
+        // Look at the final score for a while, then start over
+        if (!sawGameOver) {
+            sawGameOver = true;
+            waitSeconds = botRestartWait;
+        } else {
+            input.reset = true;
+            sawGameOver = false;
+            planned = false;
+        }
+        return input;
+    }
+    if (simulation.ballInMotion) {
+        return input;
+    }
+
+    if (!planned) {
+        const Ball& ball = simulation.ball;
+        const Tuning& tuning = simulation.tuning;
+        targetX = random.uniform(tuning.laneLeftEdge + ball.radius, tuning.laneRightEdge - ball.radius);
+        targetPower = random.uniform(botMinPower, botMaxPower);
+        planned = true;
+    }
+
+    // Steer and set power a tick's worth at a time, then let go
+    float moveStep = simulation.tuning.ballMoveSpeed * simulation.tickSeconds;
+    float powerStep = simulation.tuning.powerChangeRate * simulation.tickSeconds;
+    float offset = targetX - simulation.ball.x;
+    float powerOffset = targetPower - simulation.powerLevel;
+    input.left = offset < -moveStep;
+    input.right = offset > moveStep;
+    input.powerUp = powerOffset > powerStep;
+    input.powerDown = powerOffset < -powerStep;
+    if (!input.left && !input.right && !input.powerUp && !input.powerDown) {
+        input.throwBall = true;
+        planned = false;
+        waitSeconds = random.uniform(0.0f, botMaxWait);
+    }
+    return input;
+}
+
+Lane::Lane(double tickRate, int stressPins, std::uint64_t seed, bool botControlled, const Level& level)
+    : simulation(tickRate, level.tuning), bot(seed), botControlled(botControlled) {
+    if (!level.pins.empty()) {
+        simulation.setRack(level.pins);
+    }
+    simulation.setStressRack(stressPins);
+}
+
+void Lane::tick(const InputState& playerInput) {
+    simulation.applyInput(botControlled ? bot.nextInput(simulation) : playerInput);
+    simulation.step();
+}
+
+Alley::Alley(int laneCount, double tickRate, int stressPins, std::uint64_t seed, const std::vector<Level>& levels) {
+    laneCount = std::max(laneCount, 1);
+    lanes.reserve(laneCount);
+    Level standard;
+    for (int lane = 0; lane < laneCount; ++lane) {
+        const Level& level = levels.empty() ? standard : levels[lane % levels.size()];
+        lanes.emplace_back(tickRate, stressPins, seed ^ (lane * 0xd1b54a32d192ed03ull), lane > 0, level);
+    }
+}
+
+void Alley::advance(int ticks, const InputState& playerInput, ThreadPool& pool) {
+    if (ticks <= 0) {
+        return;
+    }
+    pool.parallelFor(lanes.size(), lanesPerRange, [&](std::size_t begin, std::size_t end, int) {
+        for (std::size_t lane = begin; lane < end; ++lane) {
+            for (int tick = 0; tick < ticks; ++tick) {
+                TRACE_SPAN("tick");
+                lanes[lane].tick(playerInput);
+            }
+        }
+    });
+}
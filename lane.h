@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "level_library.h"
+#include "simulation.h"
+#include "split_mix64.h"
+
+class ThreadPool;
+
+// Computer bowler for lanes nobody is playing: lines up on a random spot,
+// sets a random power, throws, and starts a new game a little after each
+// one ends. Works through the same controls as the keyboard.
+class LaneBot {
+public:
+    explicit LaneBot(std::uint64_t seed);
+
+    // Controls to hold for the next tick of simulation
+    InputState nextInput(const Simulation& simulation);
+
+private:
+    SplitMix64 random;
+    bool planned;
+    bool sawGameOver;
+    float targetX;
+    float targetPower;
+    float waitSeconds; // Pause before acting, so lanes drift out of step
+};
+
+// One lane of the alley: its own game and, unless a player has it, a bot
+struct Lane {
+    // Played on level's lane and rack, unless stressPins asks for a stress rack
+    Lane(double tickRate, int stressPins, std::uint64_t seed, bool botControlled, const Level& level = Level());
+
+    // Advance one tick, with player input if nobody else is playing
+    void tick(const InputState& playerInput);
+
+    Simulation simulation;
+    LaneBot bot;
+    bool botControlled;
+};
+
+// Every lane on the screen. Lane 0 is the player's; the rest are bots.
+class Alley {
+public:
+    // No lanes, until one is set up and assigned
+    Alley() = default;
+    // Lanes take levels in turn (lane n plays levels[n % size]); with none,
+    // every lane is the standard one
+    Alley(int laneCount, double tickRate, int stressPins, std::uint64_t seed = 1,
+          const std::vector<Level>& levels = {});
+
+    // Run ticks ticks on every lane. Lanes are independent, so each worker
+    // of pool takes whole lanes and runs all of their ticks for the frame.
+    void advance(int ticks, const InputState& playerInput, ThreadPool& pool);
+
+    std::vector<Lane> lanes;
+};
@@ -0,0 +1,260 @@
+#include "level_library.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const int maxRackRows = 256;
+const std::size_t maxLevelPins = 65536;
+
+struct TuningName {
+    const char* name;
+    float Tuning::* field;
+};
+
+const TuningName tuningNames[] = {
+    {"ballLaunchSpeed", &Tuning::ballLaunchSpeed},
+    {"ballFriction", &Tuning::ballFriction},
+    {"bottleDamping", &Tuning::bottleDamping},
+    {"ballMoveSpeed", &Tuning::ballMoveSpeed},
+    {"powerChangeRate", &Tuning::powerChangeRate},
+    {"toppledDuration", &Tuning::toppledDuration},
+    {"gameOverDelay", &Tuning::gameOverDelay},
+    {"sleepVelocity", &Tuning::sleepVelocity},
+    {"laneLeftEdge", &Tuning::laneLeftEdge},
+    {"laneRightEdge", &Tuning::laneRightEdge},
+    {"bottleContainment", &Tuning::bottleContainment},
+};
+
+// Take the next line from [cursor, end), without its comment or line break
+std::string_view nextLine(const char*& cursor, const char* end) {
+    const char* begin = cursor;
+    const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    cursor = lineEnd ? lineEnd + 1 : end;
+    std::string_view line(begin, (lineEnd ? lineEnd : end) - begin);
+    std::size_t comment = line.find('#');
+    return comment == std::string_view::npos ? line : line.substr(0, comment);
+}
+
+// Take the next whitespace-separated token from line; empty at the end
+std::string_view nextToken(std::string_view& line) {
+    const char* space = " \t\r";
+    std::size_t begin = line.find_first_not_of(space);
+    if (begin == std::string_view::npos) {
+        line = {};
+        return {};
+    }
+    std::size_t end = line.find_first_of(space, begin);
+    std::string_view token = line.substr(begin, end == std::string_view::npos ? end : end - begin);
+    line = end == std::string_view::npos ? std::string_view() : line.substr(end);
+    return token;
+}
+
+bool parseFloat(std::string_view token, float& value) {
+    const char* end = token.data() + token.size();
+    std::from_chars_result result = std::from_chars(token.data(), end, value);
+    return result.ec == std::errc() && result.ptr == end && std::isfinite(value);
+}
+
+bool parseInt(std::string_view token, int& value) {
+    const char* end = token.data() + token.size();
+    std::from_chars_result result = std::from_chars(token.data(), end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+// Parse the rest of line as exactly count floats
+bool parseFloats(std::string_view line, float* values, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!parseFloat(nextToken(line), values[i])) {
+            return false;
+        }
+    }
+    return nextToken(line).empty();
+}
+
+}
+
+bool LevelLibrary::open(const char* path, const char*& error, std::size_t& line) {
+    entries.clear();
+    line = 0;
+    if (!file.open(path)) {
+        error = "cannot open level file";
+        return false;
+    }
+    const char* cursor = reinterpret_cast<const char*>(file.data());
+    const char* end = cursor + file.size();
+    while (cursor < end) {
+        const char* lineStart = cursor;
+        std::string_view rest = nextLine(cursor, end);
+        line++;
+        std::string_view keyword = nextToken(rest);
+        if (keyword.empty()) {
+            continue;
+        }
+        if (keyword != "level") {
+            if (entries.empty()) {
+                error = "setting outside a level";
+                return false;
+            }
+            continue;
+        }
+        std::string_view name = nextToken(rest);
+        if (name.empty() || !nextToken(rest).empty()) {
+            error = "level needs a single-word name";
+            return false;
+        }
+        if (find(name) != entries.size()) {
+            error = "duplicate level name";
+            return false;
+        }
+        if (!entries.empty()) {
+            entries.back().end = lineStart;
+        }
+        entries.push_back({name, cursor, end, line + 1});
+    }
+    if (entries.empty()) {
+        error = "no levels";
+        return false;
+    }
+    return true;
+}
+
+std::size_t LevelLibrary::find(std::string_view name) const {
+    for (std::size_t index = 0; index < entries.size(); ++index) {
+        if (entries[index].name == name) {
+            return index;
+        }
+    }
+    return entries.size();
+}
+
+bool LevelLibrary::load(std::size_t index, Level& level, const char*& error, std::size_t& line) const {
+    const Entry& entry = entries[index];
+    level.name.assign(entry.name.data(), entry.name.size());
+    level.tuning = Tuning();
+    level.pins.clear();
+
+    const char* cursor = entry.begin;
+    line = entry.line - 1;
+    while (cursor < entry.end) {
+        std::string_view rest = nextLine(cursor, entry.end);
+        line++;
+        std::string_view keyword = nextToken(rest);
+        if (keyword.empty()) {
+            continue;
+        }
+
+        if (keyword == "lane") {
+            float values[3];
+            if (!parseFloats(rest, values, 3) || !(values[0] < values[1]) || values[2] <= 0.0f) {
+                error = "lane needs LEFT < RIGHT and a positive containment";
+                return false;
+            }
+            level.tuning.laneLeftEdge = values[0];
+            level.tuning.laneRightEdge = values[1];
+            level.tuning.bottleContainment = values[2];
+        } else if (keyword == "rack") {
+            int rows;
+            float values[4];
+            if (!parseInt(nextToken(rest), rows) || !parseFloats(rest, values, 4) || rows < 1 ||
+                rows > maxRackRows || values[3] <= 0.0f) {
+                error = "rack needs ROWS (1-256) X Y SPACING and a positive RADIUS";
+                return false;
+            }
+            appendTriangleRack(level.pins, rows, values[0], values[1], values[2], values[3]);
+        } else if (keyword == "pin") {
+            float values[3];
+            if (!parseFloats(rest, values, 3) || values[2] <= 0.0f) {
+                error = "pin needs X Y and a positive RADIUS";
+                return false;
+            }
+            level.pins.push_back({values[0], values[1], values[2]});
+        } else {
+            const TuningName* setting = nullptr;
+            for (const TuningName& tuningName : tuningNames) {
+                if (keyword == tuningName.name) {
+                    setting = &tuningName;
+                }
+            }
+            if (!setting) {
+                error = "unknown setting";
+                return false;
+            }
+            if (!parseFloats(rest, &(level.tuning.*setting->field), 1)) {
+                error = "setting needs a single number";
+                return false;
+            }
+        }
+        if (level.pins.size() > maxLevelPins) {
+            error = "too many pins";
+            return false;
+        }
+    }
+    const Tuning& tuning = level.tuning;
+    if (!(tuning.laneLeftEdge < tuning.laneRightEdge)) {
+        error = "lane edges are the wrong way round";
+        return false;
+    }
+    if (!(tuning.bottleContainment > 0.0f)) {
+        error = "bottleContainment must be positive";
+        return false;
+    }
+    // Damping is per reference frame and rescaled to the tick, which needs 0 < damping < 1
+    if (!(tuning.ballFriction > 0.0f && tuning.ballFriction < 1.0f) ||
+        !(tuning.bottleDamping > 0.0f && tuning.bottleDamping < 1.0f)) {
+        error = "ballFriction and bottleDamping must be between 0 and 1";
+        return false;
+    }
+    // A ball needs speed to leave the foul line, and a bottle or ball only
+    // stops once it is slower than sleepVelocity
+    if (!(tuning.ballLaunchSpeed > 0.0f) || !(tuning.sleepVelocity > 0.0f)) {
+        error = "ballLaunchSpeed and sleepVelocity must be positive";
+        return false;
+    }
+    if (tuning.toppledDuration < 0.0f || tuning.gameOverDelay < 0.0f || tuning.ballMoveSpeed < 0.0f ||
+        tuning.powerChangeRate < 0.0f) {
+        error = "toppledDuration, gameOverDelay, ballMoveSpeed and powerChangeRate cannot be negative";
+        return false;
+    }
+    return true;
+}
+
+bool loadLevels(const char* path, const char* names, std::vector<Level>& levels) {
+    LevelLibrary library;
+    const char* error = nullptr;
+    std::size_t line = 0;
+    if (!library.open(path, error, line)) {
+        std::fprintf(stderr, "%s:%zu: %s\n", path, line, error);
+        return false;
+    }
+
+    std::vector<std::size_t> selected;
+    if (!names) {
+        for (std::size_t index = 0; index < library.size(); ++index) {
+            selected.push_back(index);
+        }
+    }
+    for (std::string_view rest = names ? names : ""; !rest.empty();) {
+        std::size_t comma = rest.find(',');
+        std::string_view name = rest.substr(0, comma);
+        rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+        std::size_t index = library.find(name);
+        if (index == library.size()) {
+            std::fprintf(stderr, "%s: no level named %.*s\n", path, static_cast<int>(name.size()), name.data());
+            return false;
+        }
+        selected.push_back(index);
+    }
+
+    levels.resize(selected.size());
+    for (std::size_t i = 0; i < selected.size(); ++i) {
+        if (!library.load(selected[i], levels[i], error, line)) {
+            std::fprintf(stderr, "%s:%zu: %s\n", path, line, error);
+            return false;
+        }
+    }
+    return true;
+}
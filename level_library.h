@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mapped_file.h"
+#include "rack_layout.h"
+#include "simulation.h"
+
+// A lane variant: tuning and lane geometry, and the rack to set up. Pins are
+// empty for the standard 10-pin rack.
+struct Level {
+    std::string name;
+    Tuning tuning;
+    std::vector<RackPin> pins;
+};
+
+// Text file of levels, memory-mapped and parsed in place. Opening only finds
+// where each level starts; a level's lines are parsed when it is loaded, so
+// a file of hundreds of variants costs little more to open than one.
+//
+//   # Comments run to the end of the line
+//   level NAME                 starts a level; names are unique
+//   lane LEFT RIGHT CONTAIN    lane edges and how far off the lane's centre
+//                              line toppled bottles are retired
+//   FIELD VALUE                any Tuning field by name, e.g. ballFriction 0.998
+//   rack ROWS X Y SPACING RADIUS
+//                              triangular rack, widest row at Y, as the
+//                              standard one is laid out (rack 4 0.05 0.8 0.1 0.03)
+//   pin X Y RADIUS             a single pin
+//
+// Anything not given keeps its default. rack and pin lines add up, in order;
+// pins get slots in that order, so the first ten are the ones pinMask covers.
+class LevelLibrary {
+public:
+    // Map path and index its levels. Fails, with error and line set, if it
+    // cannot be read or a level line is malformed or repeats a name.
+    bool open(const char* path, const char*& error, std::size_t& line);
+
+    std::size_t size() const { return entries.size(); }
+    std::string_view name(std::size_t index) const { return entries[index].name; }
+    // Index of the level called name, or size() if there is none
+    std::size_t find(std::string_view name) const;
+    // Parse a level. Fails, with error and line set, on a malformed line.
+    bool load(std::size_t index, Level& level, const char*& error, std::size_t& line) const;
+
+private:
+    struct Entry {
+        std::string_view name;
+        const char* begin; // First line after the level line
+        const char* end;
+        std::size_t line; // Line number of begin
+    };
+
+    MappedFile file;
+    std::vector<Entry> entries;
+};
+
+// Open the library at path and load levels by comma-separated name (e.g.
+// "wide,narrow"), in order; all of them if names is null. Reports problems
+// on stderr and returns false.
+bool loadLevels(const char* path, const char* names, std::vector<Level>& levels);
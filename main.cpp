@@ -1,98 +1,118 @@
 #include <GLFW/glfw3.h>
-#include <GL/freeglut.h>
-#include <cmath>
-#include <vector>
-#include <string>
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <vector>
 
-// Ball properties
-struct Ball {
-    float x, y;
-    float radius;
-    float velocityX, velocityY;
-    bool visible;
-};
-
-// Bottle properties
-struct Bottle {
-    float x, y;
-    float radius;
-    float velocityX, velocityY;
-    bool toppled;
-    float toppledTime;
-};
-
-// Game state
-Ball ball = {0.0f, -0.8f, 0.05f, 0.0f, 0.0f, true}; // Initialize ball as visible
-std::vector<Bottle> bottles;
-int throws = 0;
-bool ballInMotion = false;
-bool gameOver = false; // Add game over flag
-float powerLevel = 0.0f;
-const float trackLeftEdge = -0.5f;
-const float trackRightEdge = 0.5f;
-const float trackBottleContainment = 0.4f;
-const float toppledDuration = 3.0f; // Time in seconds before a toppled bottle disappears
-float timeSinceLastBottleDisappeared = 0.0f; // Time since the last bottle disappeared
-int totalToppled = 0;
-
-void initBottles() {
-    bottles.clear();
-    float startX = 0.05f;
-    float startY = 0.8f;
-    float spacing = 0.1f;
-    int bottleCount = 4;
-    for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < bottleCount; ++j) {
-            bottles.push_back({startX + (j - bottleCount / 2.0f) * spacing, startY - i * spacing, 0.03f, 0.0f, 0.0f, false, 0.0f});
-        }
-        bottleCount--;
-    }
-    ball.visible = true; // Show the ball when bottles are reset
-    gameOver = false; // Reset game over flag
-    throws = 0; // Reset throws
-    ballInMotion = false; // Reset ball motion
-    timeSinceLastBottleDisappeared = 0.0f; // Reset timer
+#include "allocation_guard.h"
+#include "circle_mesh.h"
+#include "circle_renderer.h"
+#include "fixed_step.h"
+#include "font_helvetica18.h"
+#include "frame_profiler.h"
+#include "gl_functions.h"
+#include "glyph_atlas.h"
+#include "headless_modes.h"
+#include "hud_text.h"
+#include "lane.h"
+#include "render_prep.h"
+#include "replay.h"
+#include "simulation.h"
+#include "startup_profile.h"
+#include "text_renderer.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+// Game state: the player's lane, plus any bot lanes sharing the screen. Set
+// up in main(), so headless runs never build it.
+Alley alley;
+std::vector<LaneTile> laneTiles;
+
+// Replays: the player's lane can be recorded, or a replay watched in its place
+ReplayRecorder replayRecorder;
+ReplayPlayer* replayPlayer = nullptr;
+float replaySpeed = 1.0f;
+bool replayPaused = false;
+bool replaySkipToEnd = false;
+const float minReplaySpeed = 0.125f;
+const float maxReplaySpeed = 64.0f;
+int framebufferWidth = 1600;
+int framebufferHeight = 1000;
+
+// Renderer state. Circles go through one instanced draw when OpenGL 3.3 is
+// available and fall back to immediate mode otherwise; text is batched and
+// drawn from the glyph atlas once per frame.
+GlFunctions gl;
+CircleRenderer circleRenderer;
+TextRenderer textRenderer;
+bool instancedRendering = false;
+std::vector<CircleInstance> circleInstances;
+
+// HUD lines, re-formatted only when their value changes. Every lane shows
+// its own count and final score; only the player's lane has a power bar.
+std::vector<HudLine> toppledTexts;
+std::vector<HudLine> finalScoreTexts;
+HudLine powerText("Power: ", "%");
+
+// Per-phase frame timing, shown with F3
+FrameProfiler frameProfiler;
+bool profilerOverlayVisible = false;
+
+// The game shown in a lane's tile: the replay being watched, or the lane's own
+const Simulation& shownSimulation(std::size_t lane) {
+    return replayPlayer ? replayPlayer->simulation : alley.lanes[lane].simulation;
 }
 
-void renderText(float x, float y, const std::string& text) {
-    glRasterPos2f(x, y);
-    for (char c : text) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, c);
-    }
+void renderText(float x, float y, const HudLine& line) {
+    textRenderer.add(x, y, line.text(), line.length());
+}
+
+void renderText(float x, float y, const char* text) {
+    textRenderer.add(x, y, text);
 }
 
 void renderCircle(float x, float y, float radius) {
-    const int numSegments = 50;
-    float angleStep = 2.0f * 3.14f / numSegments;
+    // Pick the level of detail from the circle's size on screen
+    float pixelRadius = radius * 0.5f * std::max(framebufferWidth, framebufferHeight);
+    const std::vector<float>& points = unitCircle(circleSegments(pixelRadius));
 
     glBegin(GL_TRIANGLE_FAN);
     glVertex2f(x, y);
-    for (int i = 0; i <= numSegments; ++i) {
-        float angle = i * angleStep;
-        float px = x + cos(angle) * radius;
-        float py = y + sin(angle) * radius;
-        glVertex2f(px, py);
+    for (std::size_t i = 0; i < points.size(); i += 2) {
+        glVertex2f(x + points[i] * radius, y + points[i + 1] * radius);
     }
     glEnd();
 }
 
+// Edges of every lane still in play, in one batch
 void renderTrackEdges() {
     glBegin(GL_LINES);
-    glVertex2f(trackLeftEdge, -1.0f);
-    glVertex2f(trackLeftEdge, 1.0f);
-    glVertex2f(trackRightEdge, -1.0f);
-    glVertex2f(trackRightEdge, 1.0f);
+    for (std::size_t lane = 0; lane < alley.lanes.size(); ++lane) {
+        if (shownSimulation(lane).gameOver) {
+            continue;
+        }
+        const LaneTile& tile = laneTiles[lane];
+        const Tuning& tuning = shownSimulation(lane).tuning;
+        glVertex2f(tile.x(tuning.laneLeftEdge), tile.y(-1.0f));
+        glVertex2f(tile.x(tuning.laneLeftEdge), tile.y(1.0f));
+        glVertex2f(tile.x(tuning.laneRightEdge), tile.y(-1.0f));
+        glVertex2f(tile.x(tuning.laneRightEdge), tile.y(1.0f));
+    }
     glEnd();
 }
 
-void renderPowerBar(float powerLevel) {
-    float barWidth = 0.2f;
-    float barHeight = 0.05f;
-    float barX = -0.9f;
-    float barY = -0.9f;
+void renderPowerBar(float powerLevel, const LaneTile& tile) {
+    float barWidth = 0.2f * tile.scale;
+    float barHeight = 0.05f * tile.scale;
+    float barX = tile.x(-0.9f);
+    float barY = tile.y(-0.9f);
 
-    renderText(-0.9f, -0.8f, "Power: " + std::to_string(powerLevel * 10) + "%");
+    powerText.set(powerLevel * 10);
+    renderText(tile.x(-0.9f), tile.y(-0.8f), powerText);
     // Render the background of the power bar
     glColor3f(0.5f, 0.5f, 0.5f); // Gray color for the background
     glBegin(GL_QUADS);
@@ -113,188 +133,265 @@ void renderPowerBar(float powerLevel) {
     glEnd();
 }
 
-void processInput(GLFWwindow* window) {
-    if (glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS && !ballInMotion && !gameOver) {
-        ball.velocityY = 0.03f * ((powerLevel + 1) / 10);
-        ballInMotion = true;
+InputState processInput(GLFWwindow* window) {
+    InputState input = {};
+    input.throwBall = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+    input.left = glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS;
+    input.right = glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS;
+    input.powerUp = glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS;
+    input.powerDown = glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS;
+    input.reset = glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS;
+    return input;
+}
+
+// Speed and progress of the replay being watched, bottom right
+void renderReplayStatus() {
+    char line[96];
+    int length = std::snprintf(line, sizeof(line), "Replay %s%gx  %.1f / %.1f s  (Left/Right speed, Space pause, End skip)",
+                               replayPaused ? "paused " : "", replaySpeed,
+                               replayPlayer->currentTick() * replayPlayer->simulation.tickSeconds,
+                               replayPlayer->totalTicks() * replayPlayer->simulation.tickSeconds);
+    glColor3f(1.0f, 1.0f, 1.0f);
+    textRenderer.add(-0.1f, -0.95f, line, length);
+    textRenderer.flush();
+}
+
+void renderFinalScore(std::size_t lane) {
+    // Render final score dialog
+    const LaneTile& tile = laneTiles[lane];
+    glColor3f(1.0f, 1.0f, 1.0f); // White color for text
+    finalScoreTexts[lane].set(shownSimulation(lane).totalToppled());
+    renderText(tile.x(-0.1f), tile.y(0.0f), finalScoreTexts[lane]);
+    if (!alley.lanes[lane].botControlled && !replayPlayer) {
+        renderText(tile.x(-0.1f), tile.y(-0.2f), "Press R to Restart");
     }
-    if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS && !ballInMotion && !gameOver) {
-        ball.x -= 0.01f;
-        if (ball.x - ball.radius < trackLeftEdge) {
-            ball.x = trackLeftEdge + ball.radius;
+}
+
+// Every lane still in play goes into its own tile; lanes whose game is over
+// show their final score instead
+void renderGame() {
+    // Render ball if visible, then the bottles, for all lanes in one batch
+    circleInstances.clear();
+    for (std::size_t lane = 0; lane < alley.lanes.size(); ++lane) {
+        if (!shownSimulation(lane).gameOver) {
+            appendCircleInstances(shownSimulation(lane), circleInstances, laneTiles[lane]);
         }
     }
-    if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS && !ballInMotion && !gameOver) {
-        ball.x += 0.01f;
-        if (ball.x + ball.radius > trackRightEdge) {
-            ball.x = trackRightEdge - ball.radius;
+    if (instancedRendering) {
+        circleRenderer.draw(circleInstances, 0.5f * std::max(framebufferWidth, framebufferHeight));
+    } else {
+        for (const CircleInstance& circle : circleInstances) {
+            glColor4ub(circle.color.r, circle.color.g, circle.color.b, circle.color.a);
+            renderCircle(circle.x, circle.y, circle.radius);
         }
     }
-    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS && !ballInMotion && !gameOver) {
-        powerLevel += 0.05;
-        if (powerLevel >= 10) {
-            powerLevel = 10;
+
+    // Render track edges
+    glColor3f(1.0f, 1.0f, 1.0f); // Reset color to white
+    renderTrackEdges();
+
+    // Render number of toppled bottles, or the final score
+    for (std::size_t lane = 0; lane < alley.lanes.size(); ++lane) {
+        const Simulation& game = shownSimulation(lane);
+        const LaneTile& tile = laneTiles[lane];
+        if (game.gameOver) {
+            renderFinalScore(lane);
+            continue;
         }
-    }
-    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS && !ballInMotion && !gameOver) {
-        powerLevel -= 0.05;
-        if (powerLevel <= 0) {
-            powerLevel = 0;
+        toppledTexts[lane].set(game.totalToppled());
+        renderText(tile.x(-0.9f), tile.y(0.9f), toppledTexts[lane]);
+        if (!alley.lanes[lane].botControlled) {
+            renderPowerBar(game.powerLevel, tile);
         }
     }
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) {
-        totalToppled = 0;
-        powerLevel = 0;
-        initBottles();
-    }
+    textRenderer.flush();
 }
 
-void updateBall() {
-    if (ballInMotion) {
-        ball.y += ball.velocityY;
-        ball.velocityY *= 0.999f;
-        if (ball.y > 1.0f) {
-            ballInMotion = false;
-            ball.y = -0.8f;
-            ball.velocityY = 0.0f;
-            throws++;
-            if (throws >= 2) {
-                timeSinceLastBottleDisappeared = 0.0f; // Reset the timer
+// Stacked bars of recent frame times in the top-right corner, one color per
+// phase, with min/avg/p99 for each phase underneath
+void renderProfilerOverlay() {
+    const Color phaseColors[profilePhaseCount] = {
+        {80, 160, 255, 255},
+        {80, 220, 120, 255},
+        {240, 200, 60, 255},
+        {255, 110, 60, 255},
+        {200, 120, 255, 255},
+        {160, 160, 160, 255},
+    };
+    const int graphFrames = 240;
+    const float graphLeft = 0.3f;
+    const float graphRight = 0.95f;
+    const float graphBottom = 0.55f;
+    const float graphTop = 0.95f;
+    const float graphMs = 33.3f; // Frame time at the top of the graph
+
+    int frameCount = frameProfiler.frameCount();
+    if (frameCount == 0) {
+        return;
+    }
+    int firstFrame = std::max(0, frameCount - graphFrames);
+    float barWidth = (graphRight - graphLeft) / graphFrames;
+    float msToHeight = (graphTop - graphBottom) / graphMs;
+
+    glColor4ub(0, 0, 0, 255);
+    glBegin(GL_QUADS);
+    glVertex2f(graphLeft, graphBottom);
+    glVertex2f(graphRight, graphBottom);
+    glVertex2f(graphRight, graphTop);
+    glVertex2f(graphLeft, graphTop);
+    for (int frame = firstFrame; frame < frameCount; ++frame) {
+        float x = graphLeft + (frame - firstFrame) * barWidth;
+        float y = graphBottom;
+        for (int phase = 0; phase < profilePhaseCount; ++phase) {
+            float height = frameProfiler.phaseMs(frame, static_cast<ProfilePhase>(phase)) * msToHeight;
+            height = std::min(height, graphTop - y);
+            if (height <= 0.0f) {
+                continue;
             }
+            const Color& color = phaseColors[phase];
+            glColor4ub(color.r, color.g, color.b, color.a);
+            glVertex2f(x, y);
+            glVertex2f(x + barWidth, y);
+            glVertex2f(x + barWidth, y + height);
+            glVertex2f(x, y + height);
+            y += height;
         }
     }
-}
-
-void updateBottles(float deltaTime) {
-    bool allBottlesToppled = std::all_of(bottles.begin(), bottles.end(), [](const Bottle& bottle) {
-        return bottle.toppled;
-    });
+    glEnd();
 
-    // Hide the ball if there are any toppled bottles
-    bool anyToppledBottles = std::any_of(bottles.begin(), bottles.end(), [](const Bottle& bottle) {
-        return bottle.toppled;
-    });
+    // 60 Hz budget
+    float budgetY = graphBottom + 16.7f * msToHeight;
+    glColor3f(1.0f, 1.0f, 1.0f);
+    glBegin(GL_LINES);
+    glVertex2f(graphLeft, budgetY);
+    glVertex2f(graphRight, budgetY);
+    glEnd();
 
-    if (throws == 1 && anyToppledBottles) {
-        ball.visible = false; // Hide the ball if there are toppled bottles
+    char line[96];
+    float lineHeight = 2.0f * fontHeight / framebufferHeight;
+    float y = graphBottom - lineHeight;
+    FrameProfiler::Stats stats = frameProfiler.frameStats();
+    int length = std::snprintf(line, sizeof(line), "frame  min %.2f  avg %.2f  p99 %.2f ms",
+                               stats.minMs, stats.avgMs, stats.p99Ms);
+    textRenderer.add(graphLeft, y, line, length);
+    for (int phase = 0; phase < profilePhaseCount; ++phase) {
+        y -= lineHeight;
+        stats = frameProfiler.phaseStats(static_cast<ProfilePhase>(phase));
+        length = std::snprintf(line, sizeof(line), "%s  min %.2f  avg %.2f  p99 %.2f ms",
+                               profilePhaseName(static_cast<ProfilePhase>(phase)), stats.minMs, stats.avgMs, stats.p99Ms);
+        textRenderer.add(graphLeft, y, line, length, phaseColors[phase]);
     }
+    textRenderer.flush();
+}
 
-    if (allBottlesToppled || throws >= 2) {
-        timeSinceLastBottleDisappeared += deltaTime;
-        if (timeSinceLastBottleDisappeared > 3.0f) {
-            gameOver = true; // Set game over flag
-        }
+int main(int argc, char** argv) {
+    StartupProfile startup;
+    int exitCode = 0;
+    if (runHeadlessMode(argc, argv, exitCode)) {
+        return exitCode;
     }
 
-    for (auto& bottle : bottles) {
-        bottle.x += bottle.velocityX;
-        bottle.y += bottle.velocityY;
-        bottle.velocityX *= 0.7f; // Damping
-        bottle.velocityY *= 0.7f; // Damping
-        if ((bottle.x + bottle.radius > trackRightEdge) || (bottle.x - bottle.radius < trackLeftEdge)) {
-            bottle.velocityX = -bottle.velocityX;
-        }
-        if (bottle.toppled) {
-            bottle.toppledTime += deltaTime;
+    double tickRate = defaultTickRate;
+    int stressPins = 0;
+    int laneCount = 1;
+    int threadCount = 0;
+    bool immediateMode = false;
+    const char* profileCsvPath = nullptr;
+    const char* tracePath = nullptr;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    const char* levelsPath = nullptr;
+    const char* levelNames = nullptr;
+    bool startupProfile = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tickRate = std::max(1.0, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--stress-rack") == 0 && i + 1 < argc) {
+            stressPins = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--lanes") == 0 && i + 1 < argc) {
+            laneCount = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threadCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--immediate") == 0) {
+            immediateMode = true;
+        } else if (std::strcmp(argv[i], "--profile-csv") == 0 && i + 1 < argc) {
+            profileCsvPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--levels") == 0 && i + 1 < argc) {
+            levelsPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+            levelNames = argv[++i];
+        } else if (std::strcmp(argv[i], "--startup-profile") == 0) {
+            startupProfile = true;
         }
     }
-
-    // Remove bottles that have been toppled for longer than the duration
-    bottles.erase(std::remove_if(bottles.begin(), bottles.end(), [](const Bottle& bottle) {
-        return bottle.toppled && bottle.toppledTime > toppledDuration;
-    }), bottles.end());
-
-    // If all toppled bottles are removed, reset the ball visibility
-    if (!anyToppledBottles && throws >= 1) {
-        ball.visible = true; // Show the ball again when all toppled bottles are removed
+    if (tracePath) {
+        setTraceThreadName("main");
+        startTracing();
     }
-}
+    startup.mark("arguments");
 
-// Update the handleCollisions function to increment totalToppled only when a bottle is toppled for the first time
-void handleCollisions() {
-    // Ball and bottle collisions
-    for (auto& bottle : bottles) {
-        float dx = bottle.x - ball.x;
-        float dy = bottle.y - ball.y;
-        float distance = sqrt(dx * dx + dy * dy);
-        if (distance < ball.radius + bottle.radius) {
-            float angle = atan2(dy, dx);
-            float totalVelocity = sqrt(ball.velocityY * ball.velocityY);
-            bottle.velocityX = cos(angle) * totalVelocity;
-            bottle.velocityY = sin(angle) * totalVelocity;
-            if (!bottle.toppled) {
-                bottle.toppled = true;
-                totalToppled++; // Increment totalToppled only when a bottle is toppled for the first time
-            }
+    // Lanes take the chosen levels in turn, or every level in the file
+    std::vector<Level> levels;
+    if (levelsPath && !loadLevels(levelsPath, levelNames, levels)) {
+        return 1;
+    }
+    startup.mark("levels");
+    // A replay brings its own tick rate and rack, and takes over the screen
+    Replay replay;
+    if (replayPath) {
+        const char* error = nullptr;
+        if (!readReplay(replayPath, replay, error)) {
+            std::fprintf(stderr, "%s: %s\n", replayPath, error);
+            return 1;
         }
+        tickRate = replay.tickRate;
+        stressPins = replay.stressPins;
+        laneCount = 1;
+        recordPath = nullptr;
+        levels.clear();
     }
-
-    // Bottle and bottle collisions
-    for (size_t i = 0; i < bottles.size(); ++i) {
-        for (size_t j = i + 1; j < bottles.size(); ++j) {
-            float dx = bottles[j].x - bottles[i].x;
-            float dy = bottles[j].y - bottles[i].y;
-            float distance = sqrt(dx * dx + dy * dy);
-            if (distance < bottles[i].radius + bottles[j].radius) {
-                float angle = atan2(dy, dx);
-                float totalVelocity = sqrt(bottles[i].velocityX * bottles[i].velocityX + bottles[i].velocityY * bottles[i].velocityY);
-                bottles[j].velocityX = cos(angle) * totalVelocity;
-                bottles[j].velocityY = sin(angle) * totalVelocity;
-                if (!bottles[i].toppled) {
-                    bottles[i].toppled = true;
-                    totalToppled++; // Increment totalToppled only when a bottle is toppled for the first time
-                }
-                if (!bottles[j].toppled) {
-                    bottles[j].toppled = true;
-                    totalToppled++; // Increment totalToppled only when a bottle is toppled for the first time
-                }
-            }
+    std::unique_ptr<ReplayPlayer> player;
+    if (replayPath) {
+        player.reset(new ReplayPlayer(replay));
+        if (!player->rackMatches()) {
+            std::fprintf(stderr, "%s: recorded on a different rack than this build sets up\n", replayPath);
+            return 1;
         }
+        replayPlayer = player.get();
     }
-}
+    startup.mark("replay");
 
-// Update the renderGame function to use totalToppled without resetting it
-void renderGame() {
-    // Render ball if visible
-    if (ball.visible) {
-        glColor3f(1.0f, 1.0f, 1.0f); // Reset color to white
-        renderCircle(ball.x, ball.y, ball.radius);
+    alley = Alley(laneCount, tickRate, stressPins, 1, levels);
+    if (recordPath) {
+        replayRecorder.begin(alley.lanes[0].simulation, tickRate, stressPins);
     }
-
-    // Render bottles
-    for (const auto& bottle : bottles) {
-        if (bottle.toppled) {
-            glColor3f(1.0f, 0.0f, 0.0f); // Red color for toppled bottles
-        } else {
-            glColor3f(1.0f, 1.0f, 1.0f); // White color for standing bottles
-        }
-        renderCircle(bottle.x, bottle.y, bottle.radius);
+    layoutLaneTiles(laneCount, laneTiles);
+    toppledTexts.assign(laneCount, HudLine("Toppled Bottles: "));
+    finalScoreTexts.assign(laneCount, HudLine("Final Score: "));
+    startup.mark("lanes");
+    // No more workers than lanes; a single lane runs on the main thread alone
+    if (threadCount <= 0) {
+        threadCount = std::min(laneCount, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
     }
+    ThreadPool pool(laneCount > 1 ? threadCount : 1);
+    startup.mark("threads");
 
-    // Render track edges
-    glColor3f(1.0f, 1.0f, 1.0f); // Reset color to white
-    renderTrackEdges();
-
-    // Render number of toppled bottles
-    renderText(-0.9f, 0.9f, "Toppled Bottles: " + std::to_string(totalToppled));
-    renderPowerBar(powerLevel);
-}
-
-void renderFinalScore() {
-    // Render final score dialog
-    glColor3f(1.0f, 1.0f, 1.0f); // White color for text
-    renderText(-0.1f, 0.0f, "Final Score: " + std::to_string(totalToppled));
-    renderText(-0.1f, -0.2f, "Press R to Restart");
-}
-
-int main(int argc, char** argv) {
-    // Initialize FreeGLUT
-    glutInit(&argc, argv);
+    // Bake the glyph atlas while GLFW brings up the window; only the upload
+    // needs the context
+    std::vector<std::uint8_t> atlasPixels(atlasWidth * atlasHeight);
+    std::future<void> atlasBaked = std::async(std::launch::async, [&] { bakeGlyphAtlas(atlasPixels.data()); });
 
     // Initialize GLFW
     if (!glfwInit()) {
         return -1;
     }
+    startup.mark("glfw_init");
 
     GLFWwindow* window = glfwCreateWindow(1600, 1000, "Bowling Game", nullptr, nullptr);
     if (!window) {
@@ -306,49 +403,133 @@ int main(int argc, char** argv) {
 
     // Enable V-Sync
     glfwSwapInterval(1);
+    startup.mark("window");
 
-    glViewport(0, 0, 1600, 1000);
+    int glMajor = glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MAJOR);
+    int glMinor = glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MINOR);
+    if (!immediateMode && (glMajor > 3 || (glMajor == 3 && glMinor >= 3))) {
+        instancedRendering = loadGlFunctions(gl) && circleRenderer.init(gl);
+    }
+    startup.mark("circle_renderer");
+    atlasBaked.wait();
+    startup.mark("glyph_atlas");
+    textRenderer.init(instancedRendering ? &gl : nullptr, atlasPixels.data());
+    startup.mark("text_renderer");
+
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    textRenderer.setFramebufferSize(framebufferWidth, framebufferHeight);
     glfwSetFramebufferSizeCallback(window, [](GLFWwindow* window, int width, int height) {
+        framebufferWidth = width;
+        framebufferHeight = height;
+        textRenderer.setFramebufferSize(width, height);
         glViewport(0, 0, width, height);
     });
+    glfwSetKeyCallback(window, [](GLFWwindow*, int key, int, int action, int) {
+        if (action != GLFW_PRESS) {
+            return;
+        }
+        if (key == GLFW_KEY_F3) {
+            profilerOverlayVisible = !profilerOverlayVisible;
+        } else if (replayPlayer && key == GLFW_KEY_RIGHT) {
+            replaySpeed = std::min(replaySpeed * 2.0f, maxReplaySpeed);
+        } else if (replayPlayer && key == GLFW_KEY_LEFT) {
+            replaySpeed = std::max(replaySpeed * 0.5f, minReplaySpeed);
+        } else if (replayPlayer && key == GLFW_KEY_SPACE) {
+            replayPaused = !replayPaused;
+        } else if (replayPlayer && key == GLFW_KEY_END) {
+            replaySkipToEnd = true;
+        }
+    });
 
-    initBottles();
+    // Run physics on fixed ticks, catching up at most a quarter second per frame
+    FixedStepClock clock(tickRate, std::max(1, static_cast<int>(tickRate / 4)));
+    const std::uint64_t timerFrequency = glfwGetTimerFrequency();
+    double replayTicks = 0.0; // Ticks owed to the replay, carrying fractions at slow speeds
+    bool replayReported = false;
 
-    float lastTime = glfwGetTime();
+    // Once buffers have grown to size, frames must not touch the heap
+    FrameAllocationGuard allocationGuard(120);
+    activeProfiler() = &frameProfiler;
 
     while (!glfwWindowShouldClose(window)) {
-        // Calculate delta time
-        float currentTime = glfwGetTime();
-        float deltaTime = currentTime - lastTime;
-        lastTime = currentTime;
+        TRACE_SPAN("frame");
+        allocationGuard.beginFrame();
+        frameProfiler.beginFrame();
 
         // Input handling
-        glfwPollEvents();
-        processInput(window);
+        InputState input;
+        {
+            PROFILE_PHASE(ProfilePhase::Input);
+            glfwPollEvents();
+            input = processInput(window);
+        }
 
         // Update game state
-        if (!gameOver) {
-            updateBall();
-            updateBottles(deltaTime);
-            handleCollisions();
+        int ticks = clock.advance(timerToNanos(glfwGetTimerValue(), timerFrequency));
+        if (replayPlayer) {
+            replayTicks += replayPaused ? 0.0 : ticks * static_cast<double>(replaySpeed);
+            std::uint32_t replayTicksDue = static_cast<std::uint32_t>(replayTicks);
+            replayTicks -= replayTicksDue;
+            replayPlayer->advance(replaySkipToEnd ? replayPlayer->totalTicks() : replayTicksDue);
+            replaySkipToEnd = false;
+            if (replayPlayer->finished() && !replayReported) {
+                std::printf("Replay finished: score %d, recorded %d: %s\n", replayPlayer->simulation.totalToppled(),
+                            replay.score, replayPlayer->verified() ? "verified" : "MISMATCH");
+                replayReported = true;
+            }
+        } else {
+            replayRecorder.record(input, ticks);
+            alley.advance(ticks, input, pool);
         }
 
         // Rendering code
-        glClearColor(0.1f, 0.1f, 0.2f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        {
+            PROFILE_PHASE(ProfilePhase::Render);
+            glClearColor(0.1f, 0.1f, 0.2f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
 
-        // Render game objects or final score dialog
-        if (gameOver) {
-            renderFinalScore();
-        } else {
+            // Render game objects or final score dialogs
             renderGame();
+            if (replayPlayer) {
+                renderReplayStatus();
+            }
+            if (profilerOverlayVisible) {
+                renderProfilerOverlay();
+            }
         }
 
         // Swap buffers
-        glfwSwapBuffers(window);
+        {
+            PROFILE_PHASE(ProfilePhase::SwapBuffers);
+            glfwSwapBuffers(window);
+        }
+        frameProfiler.endFrame();
+        allocationGuard.endFrame();
+        replayRecorder.reserveAhead();
+
+        // The startup profile ends with the first frame on screen, and
+        // --startup-profile quits there
+        if (startupProfile) {
+            startup.mark("first_frame");
+            startup.print(stdout);
+            startupProfile = false;
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+        }
     }
 
+    activeProfiler() = nullptr;
     glfwTerminate();
 
+    if (recordPath && !writeReplay(recordPath, replayRecorder.finish(alley.lanes[0].simulation))) {
+        std::fprintf(stderr, "Could not write the replay to %s\n", recordPath);
+    }
+    if (profileCsvPath && !frameProfiler.writeCsv(profileCsvPath)) {
+        std::fprintf(stderr, "Could not write frame times to %s\n", profileCsvPath);
+    }
+    if (tracePath && !writeTrace(tracePath)) {
+        std::fprintf(stderr, "Could not write the trace to %s\n", tracePath);
+    }
+
     return 0;
 }
\ No newline at end of file
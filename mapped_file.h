@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Read-only memory map of a whole file. Pages are read in by the OS as they
+// are touched, so opening a large file costs nothing up front.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map path, unmapping any file mapped before. Returns false if it cannot
+    // be opened or mapped; an empty file maps to no data.
+    bool open(const char* path);
+    void close();
+
+    const std::uint8_t* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    const std::uint8_t* bytes = nullptr;
+    std::size_t length = 0;
+#if defined(_WIN32)
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+};
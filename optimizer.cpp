@@ -0,0 +1,87 @@
+#include "optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "split_mix64.h"
+#include "thread_pool.h"
+
+namespace {
+
+const std::size_t aimsPerRange = 4;
+
+Throw aimAt(const OptimizerSettings& settings, std::size_t index, float ballRadius) {
+    const Tuning& tuning = settings.level.tuning;
+    int positions = std::max(settings.positions, 1);
+    int powers = std::max(settings.powers, 1);
+    int position = static_cast<int>(index % positions);
+    int power = static_cast<int>(index / positions);
+    float left = tuning.laneLeftEdge + ballRadius;
+    float right = tuning.laneRightEdge - ballRadius;
+    // A single aim point goes down the lane's centre, wherever the level puts it
+    float x = positions > 1 ? left + (right - left) * position / (positions - 1) : 0.5f * (left + right);
+    float p = powers > 1 ? 10.0f * power / (powers - 1) : 10.0f;
+    return {x, p};
+}
+
+// Throw samplesPerAim perturbed copies of aim, adding each outcome to
+// distribution (indexed by bottles toppled) when given. Returns the mean.
+double sampleAim(Simulation& simulation, const OptimizerSettings& settings, std::size_t index, const Throw& aim,
+                 std::vector<int>* distribution) {
+    SplitMix64 random = {settings.seed ^ (index * 0xd1b54a32d192ed03ull)};
+    long long total = 0;
+    for (int sample = 0; sample < settings.samplesPerAim; ++sample) {
+        double dx, dp;
+        random.gaussianPair(dx, dp);
+        float x = aim.x + static_cast<float>(dx) * settings.positionSpread;
+        float power = aim.power + static_cast<float>(dp) * settings.powerSpread;
+        int toppled = simulation.simulateThrow(x, power).toppled;
+        total += toppled;
+        if (distribution) {
+            if (static_cast<std::size_t>(toppled) >= distribution->size()) {
+                distribution->resize(toppled + 1);
+            }
+            (*distribution)[toppled]++;
+        }
+    }
+    return settings.samplesPerAim > 0 ? static_cast<double>(total) / settings.samplesPerAim : 0.0;
+}
+
+}
+
+OptimizerResult optimizeThrow(const OptimizerSettings& settings, ThreadPool& pool) {
+    std::vector<Simulation> simulations(pool.size(), Simulation(settings.tickRate, settings.level.tuning));
+    for (Simulation& simulation : simulations) {
+        if (!settings.level.pins.empty()) {
+            simulation.setRack(settings.level.pins);
+        }
+        simulation.setStressRack(settings.stressPins);
+    }
+    float ballRadius = simulations[0].ball.radius;
+    std::size_t pinCount = simulations[0].bottles.size();
+
+    OptimizerResult result;
+    std::size_t aimCount = static_cast<std::size_t>(std::max(settings.positions, 1)) * std::max(settings.powers, 1);
+    result.aims.resize(aimCount);
+    pool.parallelFor(aimCount, aimsPerRange, [&](std::size_t begin, std::size_t end, int worker) {
+        for (std::size_t index = begin; index < end; ++index) {
+            Throw aim = aimAt(settings, index, ballRadius);
+            result.aims[index] = {aim, sampleAim(simulations[worker], settings, index, aim, nullptr)};
+        }
+    });
+
+    std::size_t bestIndex = 0;
+    for (std::size_t index = 1; index < aimCount; ++index) {
+        if (result.aims[index].expectedToppled > result.aims[bestIndex].expectedToppled) {
+            bestIndex = index;
+        }
+    }
+    result.best = result.aims[bestIndex];
+
+    // Replay the winning aim's samples (same seed, same throws) for its distribution
+    result.bestDistribution.assign(pinCount + 1, 0);
+    sampleAim(simulations[0], settings, bestIndex, result.best.aim, &result.bestDistribution);
+
+    result.throwsEvaluated = aimCount * settings.samplesPerAim;
+    return result;
+}
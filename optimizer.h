@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "level_library.h"
+#include "simulation.h"
+
+class ThreadPool;
+
+// Grid of aim points to search and how the bowler's release is perturbed
+// around each one
+struct OptimizerSettings {
+    int positions = 41; // Aim points across the lane
+    int powers = 21; // Power levels from 0 to 10
+    int samplesPerAim = 64; // Noisy throws per aim point
+    float positionSpread = 0.01f; // Standard deviation of the release position
+    float powerSpread = 0.25f; // Standard deviation of the release power
+    std::uint64_t seed = 1;
+    double tickRate = defaultTickRate;
+    int stressPins = 0; // Use a stress rack instead of the 10-pin rack
+    Level level; // Lane and rack to throw on (default: the standard lane)
+};
+
+struct AimStats {
+    Throw aim;
+    double expectedToppled;
+};
+
+struct OptimizerResult {
+    AimStats best;
+    std::vector<int> bestDistribution; // Samples of the best aim by bottles toppled
+    std::vector<AimStats> aims; // Every aim point, power-major
+    std::size_t throwsEvaluated;
+};
+
+// Monte Carlo search over release position [laneLeftEdge + radius,
+// laneRightEdge - radius] and power [0, 10] for the throw with the highest
+// expected pinfall. Aim points are spread across the pool with one
+// Simulation per worker. Every sample is seeded from its aim point, so the
+// result does not depend on the thread count or scheduling.
+OptimizerResult optimizeThrow(const OptimizerSettings& settings, ThreadPool& pool);
@@ -0,0 +1,391 @@
+#include "pin_store.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+PinStore::PinStore() {
+    allocate(0);
+}
+
+PinStore::PinStore(const PinStore& other) : arena(other.arena) {
+    bind();
+}
+
+// The moved-from pool is left empty, with capacity 0
+PinStore::PinStore(PinStore&& other) noexcept : PinStore() {
+    arena.swap(other.arena);
+    bind();
+    other.bind();
+}
+
+PinStore& PinStore::operator=(const PinStore& other) {
+    if (this != &other) {
+        arena = other.arena;
+        bind();
+    }
+    return *this;
+}
+
+PinStore& PinStore::operator=(PinStore&& other) noexcept {
+    arena.swap(other.arena);
+    bind();
+    other.bind();
+    return *this;
+}
+
+std::size_t PinStore::layout(std::size_t capacity, std::uint8_t* base) {
+    std::size_t offset = 0;
+    auto place = [&](auto*& array, std::size_t count) {
+        using T = std::remove_reference_t<decltype(*array)>;
+        array = base ? reinterpret_cast<T*>(base + offset) : nullptr;
+        offset += (count * sizeof(T) + sizeof(CacheLine) - 1) / sizeof(CacheLine) * sizeof(CacheLine);
+    };
+    std::size_t maskWords = (capacity + 63) / 64;
+    place(header, 1);
+    place(x, capacity);
+    place(y, capacity);
+    place(previousX, capacity);
+    place(previousY, capacity);
+    place(velocityX, capacity);
+    place(velocityY, capacity);
+    place(radius, capacity);
+    place(toppledTick, capacity);
+    place(slotOf, capacity);
+    place(denseIndex, capacity);
+    place(generation, capacity);
+    place(freeSlots, capacity);
+    place(pendingWakes, capacity);
+    place(toppleOrder, capacity);
+    place(aliveMask, maskWords);
+    place(toppledMask, maskWords);
+    place(wakeMask, maskWords);
+    return offset;
+}
+
+void PinStore::allocate(std::size_t capacity) {
+    std::size_t bytes = layout(capacity, nullptr);
+    arena.assign(bytes / sizeof(CacheLine), CacheLine{});
+    layout(capacity, arena.front().bytes);
+    *header = Header();
+    header->capacity = static_cast<std::uint32_t>(capacity);
+}
+
+void PinStore::bind() {
+    layout(reinterpret_cast<const Header*>(arena.front().bytes)->capacity, arena.front().bytes);
+}
+
+void PinStore::restoreArena(const std::uint8_t* data, std::size_t capacity) {
+    if (capacity != header->capacity) {
+        allocate(capacity);
+    }
+    std::memcpy(arena.front().bytes, data, arenaSize());
+}
+
+void PinStore::reset(std::size_t capacity) {
+    // Bump every generation so handles from the previous rack go stale
+    std::size_t oldCapacity = header->capacity;
+    for (std::size_t slot = 0; slot < oldCapacity; ++slot) {
+        generation[slot]++;
+    }
+    if (capacity != oldCapacity) {
+        // Slots the new pool shares with the old keep their generations; new slots start from 0
+        std::vector<std::uint32_t> kept(generation, generation + std::min(oldCapacity, capacity));
+        allocate(capacity);
+        std::copy(kept.begin(), kept.end(), generation);
+    } else {
+        // Only counters, masks and slot indices need clearing; array entries
+        // past the count are never read
+        std::size_t maskBytes = (capacity + 63) / 64 * sizeof(std::uint64_t);
+        std::fill(denseIndex, denseIndex + capacity, 0);
+        std::memset(aliveMask, 0, maskBytes);
+        std::memset(toppledMask, 0, maskBytes);
+        std::memset(wakeMask, 0, maskBytes);
+        *header = Header();
+        header->capacity = static_cast<std::uint32_t>(capacity);
+    }
+    for (std::size_t slot = 0; slot < capacity; ++slot) {
+        freeSlots[slot] = static_cast<std::uint32_t>(capacity - 1 - slot);
+    }
+    header->freeCount = static_cast<std::uint32_t>(capacity);
+}
+
+PinHandle PinStore::add(float px, float py, float r) {
+    if (header->freeCount == 0) {
+        return {header->capacity, 0};
+    }
+    std::uint32_t slot = freeSlots[--header->freeCount];
+    std::uint32_t i = header->count++;
+    denseIndex[slot] = i;
+    setBit(aliveMask, slot);
+    header->rack.onAdded();
+
+    x[i] = px;
+    y[i] = py;
+    previousX[i] = px;
+    previousY[i] = py;
+    velocityX[i] = 0.0f;
+    velocityY[i] = 0.0f;
+    radius[i] = r;
+    toppledTick[i] = 0;
+    slotOf[i] = slot;
+    return {slot, generation[slot]};
+}
+
+bool PinStore::topple(std::size_t i, std::uint32_t tick) {
+    std::uint32_t slot = slotOf[i];
+    if (testBit(toppledMask, slot)) {
+        return false;
+    }
+    setBit(toppledMask, slot);
+    header->rack.onToppled(slot);
+    toppledTick[i] = tick;
+    // Bottles are only added when the rack is set, so each slot topples at
+    // most once per rack and the queue never outgrows the capacity
+    toppleOrder[header->toppleCount++] = handle(i);
+    return true;
+}
+
+bool PinStore::oldestToppled(PinHandle& pin) const {
+    if (header->toppleHead >= header->toppleCount) {
+        return false;
+    }
+    pin = toppleOrder[header->toppleHead];
+    return true;
+}
+
+void PinStore::sleep(std::size_t i) {
+    header->awake--;
+    swap(i, header->awake);
+}
+
+void PinStore::requestWake(std::size_t i) {
+    std::uint32_t slot = slotOf[i];
+    if (i >= header->awake && !testBit(wakeMask, slot)) {
+        setBit(wakeMask, slot);
+        pendingWakes[header->pendingWakeCount++] = slot;
+    }
+}
+
+void PinStore::wakePending() {
+    for (std::uint32_t w = 0; w < header->pendingWakeCount; ++w) {
+        std::uint32_t slot = pendingWakes[w];
+        clearBit(wakeMask, slot);
+        if (testBit(aliveMask, slot)) {
+            swap(denseIndex[slot], header->awake);
+            header->awake++;
+        }
+    }
+    header->pendingWakeCount = 0;
+}
+
+void PinStore::remove(std::size_t i) {
+    std::uint32_t slot = slotOf[i];
+    header->rack.onRemoved(testBit(toppledMask, slot));
+    clearBit(aliveMask, slot);
+    clearBit(toppledMask, slot);
+    generation[slot]++;
+    freeSlots[header->freeCount++] = slot;
+
+    // Close the gap in the awake range first, then move the bottle to the end
+    if (i < header->awake) {
+        header->awake--;
+        swap(i, header->awake);
+        i = header->awake;
+    }
+    header->count--;
+    swap(i, header->count);
+}
+
+bool PinStore::contains(PinHandle pin) const {
+    return pin.slot < header->capacity && generation[pin.slot] == pin.generation && testBit(aliveMask, pin.slot);
+}
+
+void PinStore::swap(std::size_t a, std::size_t b) {
+    if (a == b) {
+        return;
+    }
+    std::swap(x[a], x[b]);
+    std::swap(y[a], y[b]);
+    std::swap(previousX[a], previousX[b]);
+    std::swap(previousY[a], previousY[b]);
+    std::swap(velocityX[a], velocityX[b]);
+    std::swap(velocityY[a], velocityY[b]);
+    std::swap(radius[a], radius[b]);
+    std::swap(toppledTick[a], toppledTick[b]);
+    std::swap(slotOf[a], slotOf[b]);
+    denseIndex[slotOf[a]] = static_cast<std::uint32_t>(a);
+    denseIndex[slotOf[b]] = static_cast<std::uint32_t>(b);
+}
+
+namespace {
+
+void saveArray(ByteWriter& writer, const float* values, std::size_t count) {
+    writer.varint(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        writer.f32(values[i]);
+    }
+}
+
+template <typename T>
+void saveArray(ByteWriter& writer, const T* values, std::size_t count) {
+    writer.varint(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        writer.fixed(values[i], sizeof(T));
+    }
+}
+
+bool loadVector(ByteReader& reader, std::vector<float>& values) {
+    std::uint64_t count = reader.varint();
+    if (!reader.has(count, sizeof(float))) {
+        return false;
+    }
+    values.resize(count);
+    for (float& value : values) {
+        value = reader.f32();
+    }
+    return true;
+}
+
+template <typename T>
+bool loadVector(ByteReader& reader, std::vector<T>& values) {
+    std::uint64_t count = reader.varint();
+    if (!reader.has(count, sizeof(T))) {
+        return false;
+    }
+    values.resize(count);
+    for (T& value : values) {
+        value = static_cast<T>(reader.fixed(sizeof(T)));
+    }
+    return true;
+}
+
+}
+
+void PinStore::save(ByteWriter& writer) const {
+    std::size_t count = header->count;
+    std::size_t slots = header->capacity;
+    saveArray(writer, x, count);
+    saveArray(writer, y, count);
+    saveArray(writer, previousX, count);
+    saveArray(writer, previousY, count);
+    saveArray(writer, velocityX, count);
+    saveArray(writer, velocityY, count);
+    saveArray(writer, radius, count);
+    saveArray(writer, toppledTick, count);
+    saveArray(writer, slotOf, count);
+
+    const RackState& rack = header->rack;
+    writer.fixed(rack.standing, 4);
+    writer.fixed(rack.toppled, 4);
+    writer.fixed(rack.removed, 4);
+    writer.fixed(rack.pinMask, 2);
+
+    writer.varint(header->toppleCount);
+    for (std::size_t i = 0; i < header->toppleCount; ++i) {
+        writer.fixed(toppleOrder[i].slot, 4);
+        writer.fixed(toppleOrder[i].generation, 4);
+    }
+    writer.varint(header->toppleHead);
+
+    saveArray(writer, denseIndex, slots);
+    saveArray(writer, generation, slots);
+    saveArray(writer, freeSlots, header->freeCount);
+    saveArray(writer, aliveMask, (slots + 63) / 64);
+    saveArray(writer, toppledMask, (slots + 63) / 64);
+    writer.varint(header->awake);
+}
+
+// Keyframes are read into vectors and checked before anything is copied into
+// the arena, so a malformed one leaves the pool as it was
+bool PinStore::load(ByteReader& reader) {
+    std::vector<float> loadedX, loadedY, loadedPreviousX, loadedPreviousY, loadedVelocityX, loadedVelocityY,
+        loadedRadius;
+    std::vector<std::uint32_t> loadedToppledTick, loadedSlotOf;
+    bool loaded = loadVector(reader, loadedX) && loadVector(reader, loadedY) && loadVector(reader, loadedPreviousX) &&
+                  loadVector(reader, loadedPreviousY) && loadVector(reader, loadedVelocityX) &&
+                  loadVector(reader, loadedVelocityY) && loadVector(reader, loadedRadius) &&
+                  loadVector(reader, loadedToppledTick) && loadVector(reader, loadedSlotOf);
+    if (!loaded) {
+        return false;
+    }
+
+    RackState rack;
+    rack.standing = static_cast<std::uint32_t>(reader.fixed(4));
+    rack.toppled = static_cast<std::uint32_t>(reader.fixed(4));
+    rack.removed = static_cast<std::uint32_t>(reader.fixed(4));
+    rack.pinMask = static_cast<std::uint16_t>(reader.fixed(2));
+
+    std::uint64_t toppleCount = reader.varint();
+    if (!reader.has(toppleCount, 8)) {
+        return false;
+    }
+    std::vector<PinHandle> loadedToppleOrder(toppleCount);
+    for (PinHandle& pin : loadedToppleOrder) {
+        pin.slot = static_cast<std::uint32_t>(reader.fixed(4));
+        pin.generation = static_cast<std::uint32_t>(reader.fixed(4));
+    }
+    std::uint64_t toppleHead = reader.varint();
+
+    std::vector<std::uint32_t> loadedDenseIndex, loadedGeneration, loadedFreeSlots;
+    std::vector<std::uint64_t> loadedAliveMask, loadedToppledMask;
+    loaded = loadVector(reader, loadedDenseIndex) && loadVector(reader, loadedGeneration) &&
+             loadVector(reader, loadedFreeSlots) && loadVector(reader, loadedAliveMask) &&
+             loadVector(reader, loadedToppledMask);
+    std::uint64_t awake = reader.varint();
+    if (!loaded || !reader.ok) {
+        return false;
+    }
+
+    // Reject anything that would index out of bounds later
+    std::size_t count = loadedX.size();
+    std::size_t slots = loadedGeneration.size();
+    std::size_t maskWords = (slots + 63) / 64;
+    if (loadedY.size() != count || loadedPreviousX.size() != count || loadedPreviousY.size() != count ||
+        loadedVelocityX.size() != count || loadedVelocityY.size() != count || loadedRadius.size() != count ||
+        loadedToppledTick.size() != count || loadedSlotOf.size() != count || loadedDenseIndex.size() != slots ||
+        loadedAliveMask.size() != maskWords || loadedToppledMask.size() != maskWords || count > slots ||
+        awake > count || toppleCount > slots || toppleHead > toppleCount || loadedFreeSlots.size() > slots) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (loadedSlotOf[i] >= slots || loadedDenseIndex[loadedSlotOf[i]] != i) {
+            return false;
+        }
+    }
+    for (std::uint32_t slot : loadedFreeSlots) {
+        if (slot >= slots) {
+            return false;
+        }
+    }
+    for (const PinHandle& pin : loadedToppleOrder) {
+        if (pin.slot >= slots) {
+            return false;
+        }
+    }
+
+    allocate(slots);
+    std::copy(loadedX.begin(), loadedX.end(), x);
+    std::copy(loadedY.begin(), loadedY.end(), y);
+    std::copy(loadedPreviousX.begin(), loadedPreviousX.end(), previousX);
+    std::copy(loadedPreviousY.begin(), loadedPreviousY.end(), previousY);
+    std::copy(loadedVelocityX.begin(), loadedVelocityX.end(), velocityX);
+    std::copy(loadedVelocityY.begin(), loadedVelocityY.end(), velocityY);
+    std::copy(loadedRadius.begin(), loadedRadius.end(), radius);
+    std::copy(loadedToppledTick.begin(), loadedToppledTick.end(), toppledTick);
+    std::copy(loadedSlotOf.begin(), loadedSlotOf.end(), slotOf);
+    std::copy(loadedToppleOrder.begin(), loadedToppleOrder.end(), toppleOrder);
+    std::copy(loadedDenseIndex.begin(), loadedDenseIndex.end(), denseIndex);
+    std::copy(loadedGeneration.begin(), loadedGeneration.end(), generation);
+    std::copy(loadedFreeSlots.begin(), loadedFreeSlots.end(), freeSlots);
+    std::copy(loadedAliveMask.begin(), loadedAliveMask.end(), aliveMask);
+    std::copy(loadedToppledMask.begin(), loadedToppledMask.end(), toppledMask);
+    header->count = static_cast<std::uint32_t>(count);
+    header->awake = static_cast<std::uint32_t>(awake);
+    header->toppleCount = static_cast<std::uint32_t>(toppleCount);
+    header->toppleHead = static_cast<std::uint32_t>(toppleHead);
+    header->freeCount = static_cast<std::uint32_t>(loadedFreeSlots.size());
+    header->rack = rack;
+    return true;
+}
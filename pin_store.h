@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "byte_stream.h"
+#include "rack_state.h"
+
+// Stable reference to a bottle. Stays valid while the bottle is in play and
+// goes stale, rather than pointing at another bottle, once it is retired.
+struct PinHandle {
+    std::uint32_t slot;
+    std::uint32_t generation;
+};
+
+// Fixed-capacity bottle pool. Bottles in play are packed at the front of
+// structure-of-arrays storage, so the collision kernel can load positions and
+// radii for several bottles at once, and retiring one moves the last bottle
+// into its place in O(1). Each bottle also owns a slot that never moves while
+// it is in play: slots carry the alive and toppled bitmasks, a generation for
+// handles, and are recycled through a free list. Slots are handed out in
+// order, so on a fresh rack the slot is the pin's position in the rack.
+// Every state change also updates the rack counters.
+//
+// Packed storage is split in two: awake bottles come first, in
+// [0, awakeCount()), and sleeping bottles, which are at rest and skipped by
+// integration, after them. Falling asleep or waking swaps a bottle across the
+// boundary.
+//
+// All of it, counters included, lives in one arena: a single allocation
+// holding a header and every array at its full capacity, each starting on a
+// cache line. The arena holds offsets and counts but no pointers, so copying
+// its bytes into a pool of the same capacity copies the pool.
+//
+// Indices below are packed (dense) indices unless named slot.
+struct PinStore {
+    PinStore();
+    PinStore(const PinStore& other);
+    PinStore(PinStore&& other) noexcept;
+    PinStore& operator=(const PinStore& other);
+    PinStore& operator=(PinStore&& other) noexcept;
+
+    // capacity() long, of which [0, size()) are in play
+    float* x;
+    float* y;
+    // Positions at the start of the current tick, for swept collision tests
+    float* previousX;
+    float* previousY;
+    float* velocityX;
+    float* velocityY;
+    float* radius;
+    // Cold data: the tick a bottle went down on
+    std::uint32_t* toppledTick;
+
+    std::size_t size() const { return header->count; }
+    bool empty() const { return header->count == 0; }
+    std::size_t capacity() const { return header->capacity; }
+    const RackState& rack() const { return header->rack; }
+
+    bool toppled(std::size_t i) const { return testBit(toppledMask, slotOf[i]); }
+    // Knock bottle i down on tick. Returns false if it was already down.
+    bool topple(std::size_t i, std::uint32_t tick);
+    // Toppled bottles in the order they went down. The oldest may already
+    // have been retired, in which case its handle is stale.
+    bool oldestToppled(PinHandle& pin) const;
+    void popOldestToppled() { header->toppleHead++; }
+
+    std::size_t awakeCount() const { return header->awake; }
+    bool isAwake(std::size_t i) const { return i < header->awake; }
+    // Put awake bottle i to sleep; the last awake bottle moves into index i
+    void sleep(std::size_t i);
+    // Mark sleeping bottle i to be woken by the next wakePending(). Packed
+    // indices stay put until then, so a collision pass can keep using them.
+    void requestWake(std::size_t i);
+    void wakePending();
+
+    // Empty the pool and size it for capacity bottles
+    void reset(std::size_t capacity);
+    // Put a sleeping bottle in play. Returns a stale handle ({capacity, 0}) when the pool is full.
+    PinHandle add(float px, float py, float r);
+    // Take bottle i out of play. Other bottles may move to fill the gap.
+    void remove(std::size_t i);
+
+    PinHandle handle(std::size_t i) const { return {slotOf[i], generation[slotOf[i]]}; }
+    bool contains(PinHandle pin) const;
+    // Packed index of a bottle in play
+    std::size_t indexOf(PinHandle pin) const { return denseIndex[pin.slot]; }
+
+    // The arena as raw bytes, for snapshots. Restoring reallocates only if
+    // capacity differs from the pool's own.
+    const std::uint8_t* arenaData() const { return arena.front().bytes; }
+    std::size_t arenaSize() const { return arena.size() * sizeof(CacheLine); }
+    void restoreArena(const std::uint8_t* data, std::size_t capacity);
+
+    // Every field, packed order and slot bookkeeping included, so a loaded
+    // pool behaves exactly like the saved one. Call between ticks, when no
+    // wakes are pending. Loading returns false on malformed data.
+    void save(ByteWriter& writer) const;
+    bool load(ByteReader& reader);
+
+private:
+    struct alignas(64) CacheLine {
+        std::uint8_t bytes[64];
+    };
+
+    struct Header {
+        std::uint32_t capacity;
+        std::uint32_t count;
+        std::uint32_t awake;
+        std::uint32_t toppleCount;
+        std::uint32_t toppleHead;
+        std::uint32_t freeCount; // freeSlots is popped from the back
+        std::uint32_t pendingWakeCount;
+        RackState rack;
+    };
+
+    static bool testBit(const std::uint64_t* mask, std::uint32_t slot) {
+        return (mask[slot >> 6] >> (slot & 63)) & 1;
+    }
+    static void setBit(std::uint64_t* mask, std::uint32_t slot) {
+        mask[slot >> 6] |= std::uint64_t(1) << (slot & 63);
+    }
+    static void clearBit(std::uint64_t* mask, std::uint32_t slot) {
+        mask[slot >> 6] &= ~(std::uint64_t(1) << (slot & 63));
+    }
+
+    // Point every array for capacity bottles into base (at null if base is)
+    // and return the arena size in bytes
+    std::size_t layout(std::size_t capacity, std::uint8_t* base);
+    // Replace the arena with a zeroed one for capacity bottles
+    void allocate(std::size_t capacity);
+    // Point the arrays into the current arena
+    void bind();
+
+    // Exchange two bottles' packed positions
+    void swap(std::size_t a, std::size_t b);
+
+    std::vector<CacheLine> arena;
+    Header* header;
+    // Packed index to slot, and slot to packed index
+    std::uint32_t* slotOf;
+    std::uint32_t* denseIndex;
+    std::uint32_t* generation;
+    std::uint32_t* freeSlots;
+    std::uint32_t* pendingWakes; // Slots
+    std::uint64_t* aliveMask;
+    std::uint64_t* toppledMask;
+    std::uint64_t* wakeMask;
+    PinHandle* toppleOrder; // toppleCount entries, the oldest unretired from toppleHead
+};
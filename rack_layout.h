@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// A pin's place on the deck when the rack is set
+struct RackPin {
+    float x, y;
+    float radius;
+};
+
+// Pin j of row row of a triangular rack, where the row has rowPins pins and
+// rows count from the widest. Each row steps spacing towards the bowler from startY.
+constexpr RackPin trianglePin(int row, int j, int rowPins, float startX, float startY, float spacing, float radius) {
+    return {startX + (j - rowPins / 2.0f) * spacing, startY - row * spacing, radius};
+}
+
+// Triangular rack of rows rows, laid out at run time for racks read from
+// level files; the same pins, in the same order, as Rack<rows>
+inline void appendTriangleRack(std::vector<RackPin>& pins, int rows, float startX, float startY, float spacing,
+                               float radius) {
+    int rowPins = rows;
+    for (int row = 0; row < rows; ++row) {
+        for (int j = 0; j < rowPins; ++j) {
+            pins.push_back(trianglePin(row, j, rowPins, startX, startY, spacing, radius));
+        }
+        rowPins--;
+    }
+}
+
+// Triangular rack of Rows rows, widest row furthest from the bowler, laid out
+// at compile time. Pin n is the n-th pin added, so it also ends up in slot n.
+// Positions use the same float arithmetic the runtime layout always did, so
+// they match it bit for bit.
+template <int Rows>
+struct Rack {
+    static_assert(Rows > 0, "a rack needs at least one row");
+
+    static constexpr std::size_t pinCount = Rows * (Rows + 1) / 2;
+
+    static constexpr float startX = 0.05f;
+    static constexpr float startY = 0.8f;
+    static constexpr float spacing = 0.1f;
+    static constexpr float pinRadius = 0.03f;
+
+    static constexpr std::array<RackPin, pinCount> makePins() {
+        std::array<RackPin, pinCount> pins = {};
+        std::size_t n = 0;
+        int rowPins = Rows;
+        for (int row = 0; row < Rows; ++row) {
+            for (int j = 0; j < rowPins; ++j) {
+                pins[n++] = trianglePin(row, j, rowPins, startX, startY, spacing, pinRadius);
+            }
+            rowPins--;
+        }
+        return pins;
+    }
+
+    static constexpr std::array<RackPin, pinCount> pins = makePins();
+};
+
+// Ten pins in rows of 4, 3, 2 and 1
+using StandardRack = Rack<4>;
+static_assert(StandardRack::pinCount == 10, "the standard rack is 10 pins");
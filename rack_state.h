@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pins of a standard rack covered by RackState::pinMask
+const std::uint32_t rackMaskPins = 10;
+
+// Bottle counts by state, updated by PinStore on every state change so each
+// query is O(1) instead of a scan over the rack
+struct RackState {
+    std::uint32_t standing = 0; // In play and upright
+    std::uint32_t toppled = 0;  // In play and down
+    std::uint32_t removed = 0;  // Retired; only toppled bottles are retired
+    // Bit n is set once the bottle in slot n (pin n of a fresh rack) has
+    // been knocked down. This is the canonical key for a throw's result.
+    std::uint16_t pinMask = 0;
+
+    void reset() { *this = RackState(); }
+    void onAdded() { standing++; }
+    void onToppled(std::uint32_t slot) {
+        standing--;
+        toppled++;
+        if (slot < rackMaskPins) {
+            pinMask |= static_cast<std::uint16_t>(1u << slot);
+        }
+    }
+    void onRemoved(bool wasToppled) {
+        if (wasToppled) {
+            toppled--;
+        } else {
+            standing--;
+        }
+        removed++;
+    }
+
+    bool allToppled() const { return standing == 0; }
+    bool anyToppled() const { return toppled > 0; }
+    // Bottles knocked down since the rack was set, retired or not
+    std::uint32_t knockedDown() const { return toppled + removed; }
+};
@@ -0,0 +1,33 @@
+#include "render_prep.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "simulation.h"
+
+void layoutLaneTiles(int count, std::vector<LaneTile>& tiles) {
+    tiles.clear();
+    count = std::max(count, 1);
+    int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count))));
+    int rows = (count + columns - 1) / columns;
+    float width = 2.0f / columns;
+    float height = 2.0f / rows;
+    for (int lane = 0; lane < count; ++lane) {
+        int row = lane / columns;
+        int column = lane % columns;
+        tiles.push_back({-1.0f + (column + 0.5f) * width, 1.0f - (row + 0.5f) * height, 0.5f * std::min(width, height)});
+    }
+}
+
+void appendCircleInstances(const Simulation& game, std::vector<CircleInstance>& instances, const LaneTile& tile) {
+    if (game.ball.visible) {
+        instances.push_back({tile.x(game.ball.x), tile.y(game.ball.y), game.ball.radius * tile.scale, colorWhite});
+    }
+
+    // Red for toppled bottles, white for standing ones
+    const PinStore& bottles = game.bottles;
+    for (std::size_t i = 0; i < bottles.size(); ++i) {
+        instances.push_back({tile.x(bottles.x[i]), tile.y(bottles.y[i]), bottles.radius[i] * tile.scale,
+                             bottles.toppled(i) ? colorRed : colorWhite});
+    }
+}
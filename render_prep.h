@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class Simulation;
+
+// RGBA colour, one byte per channel
+struct Color {
+    std::uint8_t r, g, b, a;
+};
+
+const Color colorWhite = {255, 255, 255, 255};
+const Color colorRed = {255, 0, 0, 255};
+
+// One filled circle to draw, laid out to be uploaded as a GL instance
+struct CircleInstance {
+    float x, y;
+    float radius;
+    Color color;
+};
+
+// Where a lane is drawn: lane coordinates (the [-1, 1] square a single lane
+// fills) are scaled about the origin and moved to the tile's centre, all in
+// normalized device coordinates
+struct LaneTile {
+    float centerX, centerY;
+    float scale;
+
+    float x(float laneX) const { return centerX + laneX * scale; }
+    float y(float laneY) const { return centerY + laneY * scale; }
+};
+
+const LaneTile fullScreenTile = {0.0f, 0.0f, 1.0f};
+
+// Split the screen into a grid of equal tiles for count lanes, filled row by
+// row from the top left
+void layoutLaneTiles(int count, std::vector<LaneTile>& tiles);
+
+// Append the ball (if visible) and every bottle, in draw order, placed in tile
+void appendCircleInstances(const Simulation& game, std::vector<CircleInstance>& instances,
+                           const LaneTile& tile = fullScreenTile);
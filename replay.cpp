@@ -0,0 +1,322 @@
+#include "replay.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char replayMagic[4] = {'B', 'W', 'R', 'P'};
+const std::uint64_t replayVersion = 2;
+const std::uint64_t customRackFlag = 1;
+const std::size_t reservedInputChanges = 16384;
+const std::size_t inputChangeHeadroom = 1024;
+const std::uint8_t lastRecordFlag = 0x40;
+const std::uint8_t controlsMask = 0x3f;
+
+// Tuning fields in file order. New fields go on the end with a version bump.
+float Tuning::* const tuningFields[] = {
+    &Tuning::ballLaunchSpeed,
+    &Tuning::ballFriction,
+    &Tuning::bottleDamping,
+    &Tuning::ballMoveSpeed,
+    &Tuning::powerChangeRate,
+    &Tuning::toppledDuration,
+    &Tuning::gameOverDelay,
+    &Tuning::sleepVelocity,
+    // Version 2
+    &Tuning::laneLeftEdge,
+    &Tuning::laneRightEdge,
+    &Tuning::bottleContainment,
+};
+const std::size_t version1TuningFields = 8;
+
+void hashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+}
+
+}
+
+std::uint8_t packControls(const InputState& input) {
+    return static_cast<std::uint8_t>(input.left | input.right << 1 | input.powerUp << 2 | input.powerDown << 3 |
+                                     input.throwBall << 4 | input.reset << 5);
+}
+
+InputState unpackControls(std::uint8_t controls) {
+    InputState input;
+    input.left = controls & 1;
+    input.right = controls & 2;
+    input.powerUp = controls & 4;
+    input.powerDown = controls & 8;
+    input.throwBall = controls & 16;
+    input.reset = controls & 32;
+    return input;
+}
+
+std::uint64_t simulationHash(const Simulation& simulation) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    const Ball& ball = simulation.ball;
+    const float ballState[] = {ball.x, ball.y, ball.velocityX, ball.velocityY, simulation.powerLevel,
+                               simulation.timeSinceLastBottleDisappeared};
+    const int flags[] = {simulation.throws, simulation.ballInMotion, simulation.gameOver, ball.visible,
+                         simulation.totalToppled()};
+    hashBytes(hash, ballState, sizeof(ballState));
+    hashBytes(hash, flags, sizeof(flags));
+
+    const PinStore& bottles = simulation.bottles;
+    for (std::size_t i = 0; i < bottles.size(); ++i) {
+        const float bottle[] = {bottles.x[i], bottles.y[i], bottles.velocityX[i], bottles.velocityY[i]};
+        hashBytes(hash, bottle, sizeof(bottle));
+    }
+    return hash;
+}
+
+void encodeReplay(const Replay& replay, std::vector<std::uint8_t>& bytes, std::vector<std::uint32_t>* recordOffsets) {
+    bytes.clear();
+    bytes.reserve(128 + replay.rack.size() * 4 + replay.inputs.size() * 3);
+    ByteWriter writer = {bytes};
+    writer.raw(replayMagic, sizeof(replayMagic));
+    writer.varint(replayVersion);
+    writer.f64(replay.tickRate);
+    writer.varint(static_cast<std::uint64_t>(replay.stressPins));
+    writer.varint(replay.customRack ? customRackFlag : 0);
+    for (float Tuning::* field : tuningFields) {
+        writer.f32(replay.tuning.*field);
+    }
+
+    writer.varint(replay.rack.size() / 3);
+    for (float value : replay.rack) {
+        writer.f32(value);
+    }
+
+    if (recordOffsets) {
+        recordOffsets->clear();
+    }
+    std::uint32_t previousTick = 0;
+    for (const InputChange& change : replay.inputs) {
+        if (recordOffsets) {
+            recordOffsets->push_back(static_cast<std::uint32_t>(bytes.size()));
+        }
+        writer.varint(std::uint64_t(change.tick - previousTick) << 7 | (change.controls & controlsMask));
+        previousTick = change.tick;
+    }
+    if (recordOffsets) {
+        recordOffsets->push_back(static_cast<std::uint32_t>(bytes.size()));
+    }
+    writer.varint(std::uint64_t(replay.ticks - previousTick) << 7 | lastRecordFlag);
+
+    writer.varint(static_cast<std::uint64_t>(replay.score));
+    writer.fixed(replay.stateHash, 8);
+}
+
+bool decodeReplayHeader(const std::uint8_t* data, std::size_t size, Replay& replay, bool readRack,
+                        std::size_t& recordsOffset, const char*& error) {
+    if (size < sizeof(replayMagic) || std::memcmp(data, replayMagic, sizeof(replayMagic)) != 0) {
+        error = "not a replay";
+        return false;
+    }
+    ByteReader reader = {data, size, sizeof(replayMagic)};
+    std::uint64_t version = reader.varint();
+    if (version < 1 || version > replayVersion) {
+        error = "unsupported replay version";
+        return false;
+    }
+    replay.tickRate = reader.f64();
+    replay.stressPins = static_cast<int>(reader.varint());
+    // Version 1 had no flags and played on the default lane
+    replay.customRack = version >= 2 && (reader.varint() & customRackFlag) != 0;
+    replay.tuning = Tuning();
+    std::size_t fieldCount = version >= 2 ? sizeof(tuningFields) / sizeof(tuningFields[0]) : version1TuningFields;
+    for (std::size_t field = 0; field < fieldCount; ++field) {
+        replay.tuning.*tuningFields[field] = reader.f32();
+    }
+
+    std::uint64_t bottleCount = reader.varint();
+    if (!reader.has(bottleCount, 12) || !(replay.tickRate >= 1.0)) {
+        error = "truncated replay";
+        return false;
+    }
+    if (replay.stressPins < 0 || (replay.stressPins > 0 && static_cast<std::uint64_t>(replay.stressPins) != bottleCount)) {
+        error = "rack does not match its stress pin count";
+        return false;
+    }
+    if (replay.customRack && (replay.stressPins > 0 || bottleCount == 0)) {
+        error = "custom rack has no pins";
+        return false;
+    }
+    replay.rack.clear();
+    if (readRack) {
+        replay.rack.resize(bottleCount * 3);
+        for (float& value : replay.rack) {
+            value = reader.f32();
+        }
+    } else {
+        reader.offset += bottleCount * 12;
+    }
+    recordsOffset = reader.offset;
+    return true;
+}
+
+bool readInputRecord(ByteReader& reader, std::uint32_t& tick, std::uint8_t& controls, bool& last) {
+    std::uint64_t record = reader.varint();
+    std::uint64_t nextTick = tick + (record >> 7);
+    if (!reader.ok || nextTick > UINT32_MAX) {
+        return false;
+    }
+    tick = static_cast<std::uint32_t>(nextTick);
+    controls = static_cast<std::uint8_t>(record & controlsMask);
+    last = (record & lastRecordFlag) != 0;
+    return true;
+}
+
+bool decodeReplay(const std::uint8_t* data, std::size_t size, Replay& replay, const char*& error) {
+    std::size_t recordsOffset;
+    if (!decodeReplayHeader(data, size, replay, true, recordsOffset, error)) {
+        return false;
+    }
+
+    ByteReader reader = {data, size, recordsOffset};
+    replay.inputs.clear();
+    std::uint32_t tick = 0;
+    for (;;) {
+        std::uint8_t controls;
+        bool last;
+        if (!readInputRecord(reader, tick, controls, last)) {
+            error = "truncated replay";
+            return false;
+        }
+        if (last) {
+            break;
+        }
+        replay.inputs.push_back({tick, controls});
+    }
+    replay.ticks = tick;
+
+    replay.score = static_cast<int>(reader.varint());
+    replay.stateHash = reader.fixed(8);
+    if (!reader.ok) {
+        error = "truncated replay";
+        return false;
+    }
+    return true;
+}
+
+bool writeReplay(const char* path, const Replay& replay) {
+    std::vector<std::uint8_t> bytes;
+    encodeReplay(replay, bytes);
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return std::fclose(file) == 0 && written;
+}
+
+bool readReplay(const char* path, Replay& replay, const char*& error) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        error = "cannot open replay";
+        return false;
+    }
+    std::vector<std::uint8_t> bytes;
+    std::uint8_t chunk[4096];
+    std::size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        bytes.insert(bytes.end(), chunk, chunk + read);
+    }
+    std::fclose(file);
+    return decodeReplay(bytes.data(), bytes.size(), replay, error);
+}
+
+void ReplayRecorder::begin(const Simulation& simulation, double tickRate, int stressPins) {
+    replay = Replay();
+    replay.tickRate = tickRate;
+    replay.stressPins = stressPins;
+    replay.customRack = stressPins == 0 && !simulation.customRack().empty();
+    replay.tuning = simulation.tuning;
+    const PinStore& bottles = simulation.bottles;
+    for (std::size_t i = 0; i < bottles.size(); ++i) {
+        replay.rack.push_back(bottles.x[i]);
+        replay.rack.push_back(bottles.y[i]);
+        replay.rack.push_back(bottles.radius[i]);
+    }
+    replay.inputs.reserve(reservedInputChanges);
+    lastControls = 0;
+    active = true;
+}
+
+void ReplayRecorder::record(const InputState& input, int ticks) {
+    if (!active || ticks <= 0) {
+        return;
+    }
+    std::uint8_t controls = packControls(input);
+    if (controls != lastControls) {
+        replay.inputs.push_back({replay.ticks, controls});
+        lastControls = controls;
+    }
+    replay.ticks += static_cast<std::uint32_t>(ticks);
+}
+
+void ReplayRecorder::reserveAhead() {
+    if (active && replay.inputs.capacity() - replay.inputs.size() < inputChangeHeadroom) {
+        replay.inputs.reserve(replay.inputs.capacity() * 2);
+    }
+}
+
+const Replay& ReplayRecorder::finish(const Simulation& simulation) {
+    replay.score = simulation.totalToppled();
+    replay.stateHash = simulationHash(simulation);
+    active = false;
+    return replay;
+}
+
+void setUpRack(Simulation& simulation, const Replay& replay) {
+    if (!replay.customRack) {
+        simulation.setStressRack(replay.stressPins);
+        return;
+    }
+    std::vector<RackPin> pins(replay.rack.size() / 3);
+    for (std::size_t i = 0; i < pins.size(); ++i) {
+        pins[i] = {replay.rack[i * 3], replay.rack[i * 3 + 1], replay.rack[i * 3 + 2]};
+    }
+    simulation.setRack(pins);
+}
+
+ReplayPlayer::ReplayPlayer(const Replay& replay) : simulation(replay.tickRate, replay.tuning), replay(replay) {
+    setUpRack(simulation, replay);
+}
+
+bool ReplayPlayer::rackMatches() const {
+    const PinStore& bottles = simulation.bottles;
+    if (replay.rack.size() != bottles.size() * 3) {
+        return false;
+    }
+    for (std::size_t i = 0; i < bottles.size(); ++i) {
+        const float bottle[] = {bottles.x[i], bottles.y[i], bottles.radius[i]};
+        if (std::memcmp(bottle, &replay.rack[i * 3], sizeof(bottle)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::uint32_t ReplayPlayer::advance(std::uint32_t ticks) {
+    std::uint32_t run = 0;
+    while (run < ticks && tick < replay.ticks) {
+        if (nextInput < replay.inputs.size() && replay.inputs[nextInput].tick == tick) {
+            input = unpackControls(replay.inputs[nextInput].controls);
+            nextInput++;
+        }
+        simulation.applyInput(input);
+        simulation.step();
+        tick++;
+        run++;
+    }
+    return run;
+}
+
+bool ReplayPlayer::verified() const {
+    return finished() && simulation.totalToppled() == replay.score && simulationHash(simulation) == replay.stateHash;
+}
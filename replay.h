@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "byte_stream.h"
+#include "simulation.h"
+
+// A recorded session on one lane: everything needed to re-simulate it
+// bit-exactly, plus the outcome to check the re-simulation against.
+//
+// On disk, little-endian:
+//   "BWRP", version (varint)
+//   tick rate (f64), stress pins (varint), flags (varint), Tuning fields
+//     (f32 each)
+//   rack: bottle count (varint), then x, y, radius (f32) per bottle
+//   input changes: varint (ticks since the previous change << 7 | flag << 6
+//     | controls), where controls has a bit per InputState field; the flag
+//     marks the last record, whose tick delta runs to the end of the session
+//   score (varint), state hash (u64)
+// Controls held for many ticks cost one record, so a whole game is a few
+// dozen bytes after the header. Flag bit 0 marks a custom rack (e.g. from a
+// level file): playback sets up the recorded rack instead of building one.
+// Version 1 files have no flags and only the first eight Tuning fields.
+// The per-tick constants playback derives from the tick rate and Tuning
+// (damping, glide per tick) are computed with fast_math.h's fastPow, not
+// libm, so a replay re-simulates the same on every machine.
+struct InputChange {
+    std::uint32_t tick; // First tick the controls are held for
+    std::uint8_t controls;
+};
+
+struct Replay {
+    double tickRate = defaultTickRate;
+    int stressPins = 0;
+    bool customRack = false;
+    Tuning tuning;
+    std::vector<float> rack; // x, y, radius per bottle
+    std::vector<InputChange> inputs;
+    std::uint32_t ticks = 0;
+    int score = 0;
+    std::uint64_t stateHash = 0;
+};
+
+std::uint8_t packControls(const InputState& input);
+InputState unpackControls(std::uint8_t controls);
+
+// Hash of the ball, game flags and every bottle's position and velocity bits
+std::uint64_t simulationHash(const Simulation& simulation);
+
+// Encode to or decode from the format above. Decoding returns false, with
+// error set, on anything malformed or from a newer version.
+// recordOffsets, if given, receives the byte offset of every input change's
+// record followed by the offset of the last record.
+void encodeReplay(const Replay& replay, std::vector<std::uint8_t>& bytes,
+                  std::vector<std::uint32_t>* recordOffsets = nullptr);
+bool decodeReplay(const std::uint8_t* data, std::size_t size, Replay& replay, const char*& error);
+// Decode only the settings and, if readRack, the rack, leaving inputs empty.
+// recordsOffset is set to where the input records start.
+bool decodeReplayHeader(const std::uint8_t* data, std::size_t size, Replay& replay, bool readRack,
+                        std::size_t& recordsOffset, const char*& error);
+// Read the input record at reader, moving tick on by its delta. last is set
+// for the record that ends the session. Returns false if it is malformed.
+bool readInputRecord(ByteReader& reader, std::uint32_t& tick, std::uint8_t& controls, bool& last);
+bool writeReplay(const char* path, const Replay& replay);
+// Give simulation the rack replay was recorded on: its stress rack, its
+// custom rack, or the normal one
+void setUpRack(Simulation& simulation, const Replay& replay);
+bool readReplay(const char* path, Replay& replay, const char*& error);
+
+// Collects a lane's input tick by tick. Only changes are stored, at most one
+// per record, into a buffer reserved up front. record never grows it; call
+// reserveAhead between frames, outside the allocation checks, and recording
+// from the frame loop does not allocate however long the session runs.
+class ReplayRecorder {
+public:
+    // Start recording simulation as it stands, with stressPins as set on it
+    void begin(const Simulation& simulation, double tickRate, int stressPins);
+    // input was held for ticks more ticks
+    void record(const InputState& input, int ticks);
+    // Grow the input buffer if it is nearly full
+    void reserveAhead();
+    // Seal the replay with simulation's outcome
+    const Replay& finish(const Simulation& simulation);
+
+    bool recording() const { return active; }
+
+private:
+    Replay replay;
+    std::uint8_t lastControls = 0;
+    bool active = false;
+};
+
+// Re-simulates a replay on a simulation built from its settings
+class ReplayPlayer {
+public:
+    explicit ReplayPlayer(const Replay& replay);
+
+    // Whether this build sets up the same rack the replay was recorded on
+    bool rackMatches() const;
+    // Run up to ticks ticks; returns the number run
+    std::uint32_t advance(std::uint32_t ticks);
+    bool finished() const { return tick >= replay.ticks; }
+    // After finishing: whether the outcome matches the recording bit for bit
+    bool verified() const;
+
+    std::uint32_t currentTick() const { return tick; }
+    std::uint32_t totalTicks() const { return replay.ticks; }
+    Simulation simulation;
+
+private:
+    const Replay& replay;
+    std::size_t nextInput = 0;
+    std::uint32_t tick = 0;
+    InputState input = {};
+};
@@ -0,0 +1,283 @@
+#include "replay_archive.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const char archiveMagic[4] = {'B', 'W', 'A', 'R'};
+const std::uint32_t archiveVersion = 1;
+const std::size_t archiveHeaderSize = 8;
+const std::size_t archiveTrailerSize = 24;
+const std::size_t indexEntrySize = 40;
+const std::size_t keyframeEntrySize = 28;
+
+struct Keyframe {
+    std::uint32_t tick;
+    std::uint32_t previousChangeTick; // Tick of the last input change at or before tick
+    std::uint32_t recordOffset; // Next input record, from the start of the replay
+    std::uint32_t controls; // Controls held since previousChangeTick
+    std::uint64_t stateOffset;
+    std::uint32_t stateLength;
+};
+
+// Whether [offset, offset + length) lies within size bytes
+bool inBounds(std::uint64_t offset, std::uint64_t length, std::size_t size) {
+    return offset <= size && length <= size - offset;
+}
+
+}
+
+ReplayArchiveWriter::~ReplayArchiveWriter() {
+    if (file) {
+        std::fclose(file);
+    }
+}
+
+bool ReplayArchiveWriter::open(const char* path) {
+    file = std::fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    offset = 0;
+    failed = false;
+    entries.clear();
+    bytes.clear();
+    ByteWriter writer = {bytes};
+    writer.raw(archiveMagic, sizeof(archiveMagic));
+    writer.fixed(archiveVersion, 4);
+    return write(bytes);
+}
+
+bool ReplayArchiveWriter::write(const std::vector<std::uint8_t>& data) {
+    if (!failed && std::fwrite(data.data(), 1, data.size(), file) != data.size()) {
+        failed = true;
+    }
+    offset += data.size();
+    return !failed;
+}
+
+bool ReplayArchiveWriter::add(const Replay& replay, std::uint32_t keyframeInterval, const char*& error) {
+    keyframeInterval = std::max<std::uint32_t>(keyframeInterval, 1);
+    ReplayPlayer player(replay);
+    if (!player.rackMatches()) {
+        error = "recorded on a different rack than this build sets up";
+        return false;
+    }
+
+    ArchiveEntry entry = {};
+    entry.replayOffset = offset;
+    entry.ticks = replay.ticks;
+    entry.score = static_cast<std::uint32_t>(replay.score);
+    entry.keyframeInterval = keyframeInterval;
+    // The replay and its keyframe states are gathered in bytes and only
+    // written once the replay verifies, so a rejected one leaves nothing behind
+    encodeReplay(replay, bytes, &recordOffsets);
+    entry.replayLength = static_cast<std::uint32_t>(bytes.size());
+
+    // Keyframe at 0, keyframeInterval, ... up to the last tick
+    table.clear();
+    ByteWriter tableWriter = {table};
+    for (std::uint32_t tick = 0;; tick += keyframeInterval) {
+        auto next = std::partition_point(replay.inputs.begin(), replay.inputs.end(),
+                                         [tick](const InputChange& change) { return change.tick < tick; });
+        std::size_t nextIndex = static_cast<std::size_t>(next - replay.inputs.begin());
+        Keyframe keyframe = {};
+        keyframe.tick = tick;
+        if (nextIndex > 0) {
+            keyframe.previousChangeTick = replay.inputs[nextIndex - 1].tick;
+            keyframe.controls = replay.inputs[nextIndex - 1].controls;
+        }
+        keyframe.recordOffset = recordOffsets[nextIndex];
+        std::size_t stateStart = bytes.size();
+        player.simulation.saveState(bytes);
+        keyframe.stateOffset = offset + stateStart;
+        keyframe.stateLength = static_cast<std::uint32_t>(bytes.size() - stateStart);
+
+        tableWriter.fixed(keyframe.tick, 4);
+        tableWriter.fixed(keyframe.previousChangeTick, 4);
+        tableWriter.fixed(keyframe.recordOffset, 4);
+        tableWriter.fixed(keyframe.controls, 4);
+        tableWriter.fixed(keyframe.stateOffset, 8);
+        tableWriter.fixed(keyframe.stateLength, 4);
+        entry.keyframeCount++;
+
+        if (replay.ticks - tick < keyframeInterval) {
+            break;
+        }
+        player.advance(keyframeInterval);
+    }
+
+    // Keyframes are only worth keeping if the game they come from is the one recorded
+    player.advance(replay.ticks);
+    if (!player.verified()) {
+        error = "does not re-simulate to its recorded outcome";
+        return false;
+    }
+
+    if (!write(bytes)) {
+        error = "write failed";
+        return false;
+    }
+    entry.keyframeTableOffset = offset;
+    if (!write(table)) {
+        error = "write failed";
+        return false;
+    }
+    entries.push_back(entry);
+    return true;
+}
+
+bool ReplayArchiveWriter::finish() {
+    if (!file) {
+        return false;
+    }
+    std::uint64_t indexOffset = offset;
+    bytes.clear();
+    ByteWriter writer = {bytes};
+    for (const ArchiveEntry& entry : entries) {
+        writer.fixed(entry.replayOffset, 8);
+        writer.fixed(entry.replayLength, 4);
+        writer.fixed(entry.ticks, 4);
+        writer.fixed(entry.score, 4);
+        writer.fixed(entry.keyframeInterval, 4);
+        writer.fixed(entry.keyframeTableOffset, 8);
+        writer.fixed(entry.keyframeCount, 4);
+        writer.fixed(0, 4);
+    }
+    writer.fixed(indexOffset, 8);
+    writer.fixed(entries.size(), 8);
+    writer.raw(archiveMagic, sizeof(archiveMagic));
+    writer.fixed(archiveVersion, 4);
+    write(bytes);
+
+    bool closed = std::fclose(file) == 0;
+    file = nullptr;
+    return closed && !failed;
+}
+
+void ArchiveCursor::readNextChange() {
+    bool last = false;
+    hasNextChange = readInputRecord(records, nextChangeTick, nextControls, last) && !last;
+}
+
+std::uint32_t ArchiveCursor::advance(std::uint32_t count) {
+    std::uint32_t run = 0;
+    while (run < count && tick < ticks) {
+        if (hasNextChange && nextChangeTick == tick) {
+            input = unpackControls(nextControls);
+            readNextChange();
+        }
+        simulation.applyInput(input);
+        simulation.step();
+        tick++;
+        run++;
+    }
+    return run;
+}
+
+bool ReplayArchive::open(const char* path, const char*& error) {
+    if (!file.open(path)) {
+        error = "cannot open archive";
+        return false;
+    }
+    const std::uint8_t* data = file.data();
+    std::size_t size = file.size();
+    if (size < archiveHeaderSize + archiveTrailerSize || std::memcmp(data, archiveMagic, sizeof(archiveMagic)) != 0) {
+        error = "not a replay archive";
+        return false;
+    }
+    ByteReader trailer = {data, size, size - archiveTrailerSize};
+    indexOffset = trailer.fixed(8);
+    gameCount = trailer.fixed(8);
+    bool sealed = std::memcmp(data + size - 8, archiveMagic, sizeof(archiveMagic)) == 0;
+    trailer.offset += sizeof(archiveMagic);
+    if (!sealed || trailer.fixed(4) != archiveVersion) {
+        error = "unsupported or unfinished archive";
+        return false;
+    }
+    if (indexOffset < archiveHeaderSize || gameCount > (size - archiveTrailerSize) / indexEntrySize ||
+        indexOffset + gameCount * indexEntrySize != size - archiveTrailerSize) {
+        error = "corrupt archive index";
+        return false;
+    }
+    return true;
+}
+
+bool ReplayArchive::entry(std::size_t game, ArchiveEntry& entry) const {
+    if (game >= gameCount) {
+        return false;
+    }
+    ByteReader reader = {file.data(), file.size(), static_cast<std::size_t>(indexOffset + game * indexEntrySize)};
+    entry.replayOffset = reader.fixed(8);
+    entry.replayLength = static_cast<std::uint32_t>(reader.fixed(4));
+    entry.ticks = static_cast<std::uint32_t>(reader.fixed(4));
+    entry.score = static_cast<std::uint32_t>(reader.fixed(4));
+    entry.keyframeInterval = static_cast<std::uint32_t>(reader.fixed(4));
+    entry.keyframeTableOffset = reader.fixed(8);
+    entry.keyframeCount = static_cast<std::uint32_t>(reader.fixed(4));
+    return reader.ok && inBounds(entry.replayOffset, entry.replayLength, file.size()) &&
+           inBounds(entry.keyframeTableOffset, std::uint64_t(entry.keyframeCount) * keyframeEntrySize, file.size()) &&
+           entry.keyframeInterval > 0 && entry.keyframeCount > 0;
+}
+
+bool ReplayArchive::readReplay(std::size_t game, Replay& replay, const char*& error) const {
+    ArchiveEntry found;
+    if (!entry(game, found)) {
+        error = "no such game";
+        return false;
+    }
+    return decodeReplay(file.data() + found.replayOffset, found.replayLength, replay, error);
+}
+
+bool ReplayArchive::seek(std::size_t game, std::uint32_t tick, ArchiveCursor& cursor, const char*& error) const {
+    ArchiveEntry found;
+    if (!entry(game, found)) {
+        error = "no such game";
+        return false;
+    }
+    tick = std::min(tick, found.ticks);
+    std::uint32_t index = std::min(tick / found.keyframeInterval, found.keyframeCount - 1);
+    ByteReader table = {file.data(), file.size(),
+                        static_cast<std::size_t>(found.keyframeTableOffset + index * keyframeEntrySize)};
+    Keyframe keyframe;
+    keyframe.tick = static_cast<std::uint32_t>(table.fixed(4));
+    keyframe.previousChangeTick = static_cast<std::uint32_t>(table.fixed(4));
+    keyframe.recordOffset = static_cast<std::uint32_t>(table.fixed(4));
+    keyframe.controls = static_cast<std::uint32_t>(table.fixed(4));
+    keyframe.stateOffset = table.fixed(8);
+    keyframe.stateLength = static_cast<std::uint32_t>(table.fixed(4));
+    if (!table.ok || keyframe.tick > tick || keyframe.recordOffset > found.replayLength ||
+        !inBounds(keyframe.stateOffset, keyframe.stateLength, file.size())) {
+        error = "corrupt keyframe";
+        return false;
+    }
+
+    // Only the replay's settings are needed; its inputs are read as the cursor
+    // reaches them. A custom rack is read too, for the resets after the keyframe.
+    const std::uint8_t* replayData = file.data() + found.replayOffset;
+    Replay settings;
+    std::size_t recordsOffset;
+    if (!decodeReplayHeader(replayData, found.replayLength, settings, false, recordsOffset, error) ||
+        (settings.customRack &&
+         !decodeReplayHeader(replayData, found.replayLength, settings, true, recordsOffset, error))) {
+        return false;
+    }
+    cursor.simulation = Simulation(settings.tickRate, settings.tuning);
+    if (settings.customRack) {
+        setUpRack(cursor.simulation, settings);
+    }
+    if (!cursor.simulation.loadState(file.data() + keyframe.stateOffset, keyframe.stateLength)) {
+        error = "corrupt keyframe";
+        return false;
+    }
+
+    cursor.records = {replayData, found.replayLength, keyframe.recordOffset};
+    cursor.input = unpackControls(static_cast<std::uint8_t>(keyframe.controls));
+    cursor.nextChangeTick = keyframe.previousChangeTick;
+    cursor.readNextChange();
+    cursor.tick = keyframe.tick;
+    cursor.ticks = found.ticks;
+    cursor.advance(tick - keyframe.tick);
+    return true;
+}
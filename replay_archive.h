@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "mapped_file.h"
+#include "replay.h"
+
+// Many replays in one file, for random access to any game and any tick
+// without reading the rest of the archive.
+//
+// Layout, little-endian:
+//   "BWAR", version (u32)
+//   per game: the replay (format in replay.h), its keyframe states back to
+//     back, then its keyframe table
+//   index: one ArchiveEntry per game
+//   trailer: index offset (u64), game count (u64), "BWAR", version (u32)
+//
+// Keyframes are taken every keyframeInterval ticks from tick 0. Each holds
+// the full simulation state (Simulation::saveState) and where the replay's
+// input records stand at that tick. Index and keyframe table entries have a
+// fixed size, so finding a game, or the keyframe before a tick, is
+// arithmetic rather than a search.
+struct ArchiveEntry {
+    std::uint64_t replayOffset;
+    std::uint32_t replayLength;
+    std::uint32_t ticks;
+    std::uint32_t score;
+    std::uint32_t keyframeInterval;
+    std::uint64_t keyframeTableOffset;
+    std::uint32_t keyframeCount;
+};
+
+class ReplayArchiveWriter {
+public:
+    ~ReplayArchiveWriter();
+
+    bool open(const char* path);
+    // Re-simulate replay, keyframing every keyframeInterval ticks, and append
+    // it. Fails, with error set, if the replay does not re-simulate to its
+    // recorded outcome in this build, in which case nothing is written, or if
+    // the file cannot be written.
+    bool add(const Replay& replay, std::uint32_t keyframeInterval, const char*& error);
+    // Write the index and trailer and close the file
+    bool finish();
+
+private:
+    bool write(const std::vector<std::uint8_t>& bytes);
+
+    std::FILE* file = nullptr;
+    std::uint64_t offset = 0;
+    bool failed = false;
+    std::vector<ArchiveEntry> entries;
+    // Scratch, reused for every replay
+    std::vector<std::uint8_t> bytes;
+    std::vector<std::uint8_t> table;
+    std::vector<std::uint32_t> recordOffsets;
+};
+
+// A game being played back from an archive. Inputs are decoded straight
+// from the mapped file one record at a time, so the cursor is only valid
+// while its archive stays open.
+class ArchiveCursor {
+public:
+    // Run up to ticks ticks; returns the number run
+    std::uint32_t advance(std::uint32_t ticks);
+    bool finished() const { return tick >= ticks; }
+    std::uint32_t currentTick() const { return tick; }
+
+    Simulation simulation;
+
+private:
+    friend class ReplayArchive;
+
+    void readNextChange();
+
+    ByteReader records = {nullptr, 0};
+    bool hasNextChange = false;
+    std::uint32_t nextChangeTick = 0;
+    std::uint8_t nextControls = 0;
+    InputState input = {};
+    std::uint32_t tick = 0;
+    std::uint32_t ticks = 0;
+};
+
+class ReplayArchive {
+public:
+    // Map the archive and check its trailer; nothing else is read until asked for
+    bool open(const char* path, const char*& error);
+
+    std::size_t size() const { return gameCount; }
+    bool entry(std::size_t game, ArchiveEntry& entry) const;
+    // Decode a whole replay
+    bool readReplay(std::size_t game, Replay& replay, const char*& error) const;
+    // Put cursor at tick of game (clamped to its end): restore the keyframe at
+    // or before tick and re-simulate from there, at most keyframeInterval - 1 ticks
+    bool seek(std::size_t game, std::uint32_t tick, ArchiveCursor& cursor, const char*& error) const;
+
+private:
+    MappedFile file;
+    std::uint64_t indexOffset = 0;
+    std::uint64_t gameCount = 0;
+};
@@ -0,0 +1,500 @@
+#include "simulation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "collision_kernel.h"
+#include "fast_math.h"
+#include "frame_profiler.h"
+#include "rack_layout.h"
+#include "trace.h"
+
+static_assert(StandardRack::pinCount <= rackMaskPins, "every standard pin needs a pinMask bit");
+
+namespace {
+
+const float maxSettleTime = 10.0f; // Seconds to wait for the rack to come to rest after the ball leaves
+const float maxBallTime = 60.0f; // Seconds a simulated throw's ball may roll before it is called back
+// Contact pairs to make room for per bottle. Equal circles fit at most six
+// around one, three pairs per bottle, so this covers a crowded rack twice over.
+const std::size_t reservedPairsPerBottle = 6;
+
+// Per-tick travel for a velocity that keeps damping of itself per reference
+// frame: each tick covers its share of the total glide, v / 60 / (1 - damping),
+// which is exactly velocity * tickSeconds at the reference rate
+double travelPerTick(double damping, double tickRate) {
+    double dampingPerTick = fastPow(damping, referenceFrameRate / tickRate);
+    return (1.0 - dampingPerTick) / (1.0 - damping) / referenceFrameRate;
+}
+
+// Offset between two circles when they first touch during a tick, given the
+// offset at the start of the tick (dx0, dy0) and how it changes (ex, ey).
+// Used for contacts that a swept test found but that no longer overlap at the
+// end of the tick, where the end-of-tick offset would point the wrong way.
+void impactOffset(float dx0, float dy0, float ex, float ey, float reach, float& dx, float& dy) {
+    float a = ex * ex + ey * ey;
+    float b = dx0 * ex + dy0 * ey;
+    float c = dx0 * dx0 + dy0 * dy0 - reach * reach;
+    float t = 0.0f;
+    if (c > 0.0f && a > minSweepSquared) {
+        float discriminant = b * b - a * c;
+        // A grazing sweep that only just misses in this arithmetic touches at closest approach
+        t = discriminant > 0.0f ? (-b - fastSqrt(discriminant)) / a : -b / a;
+        t = std::min(std::max(t, 0.0f), 1.0f);
+    }
+    dx = dx0 + t * ex;
+    dy = dy0 + t * ey;
+}
+
+// Send bottle i away along (dx, dy) at speed. Coincident centres send it
+// along +x, as the angle of a zero offset always did.
+void pushBottle(PinStore& bottles, std::size_t i, float dx, float dy, float speed) {
+    float lengthSquared = dx * dx + dy * dy;
+    if (lengthSquared > 0.0f) {
+        float scale = speed * fastRsqrt(lengthSquared);
+        bottles.velocityX[i] = dx * scale;
+        bottles.velocityY[i] = dy * scale;
+    } else {
+        bottles.velocityX[i] = speed;
+        bottles.velocityY[i] = 0.0f;
+    }
+}
+
+}
+
+Simulation::Simulation(double tickRate, const Tuning& tuning)
+    : tuning(tuning),
+      tickSeconds(static_cast<float>(1.0 / tickRate)),
+      ballFrictionPerTick(static_cast<float>(fastPow(tuning.ballFriction, referenceFrameRate / tickRate))),
+      bottleDampingPerTick(static_cast<float>(fastPow(tuning.bottleDamping, referenceFrameRate / tickRate))),
+      ballTravelPerTick(static_cast<float>(travelPerTick(tuning.ballFriction, tickRate))),
+      bottleTravelPerTick(static_cast<float>(travelPerTick(tuning.bottleDamping, tickRate))),
+      ball{0.0f, -0.8f, 0.05f, 0.0f, 0.0f, true}, // Initialize ball as visible
+      throws(0),
+      ballInMotion(false),
+      gameOver(false),
+      powerLevel(0.0f),
+      timeSinceLastBottleDisappeared(0.0f),
+      stressPinCount(0),
+      ballStartX(ball.x),
+      ballStartY(ball.y),
+      tickCount(0) {
+    initBottles();
+}
+
+void Simulation::initBottles() {
+    // Same capacity every time, so resetting a rack reuses the pool's arena.
+    // The standard rack goes through the pool too, sized from its compile-time
+    // pin count, rather than keeping its own fixed arrays: the collision
+    // kernel, sleeping, handles and snapshots all work on the pool's arena.
+    if (stressPinCount > 0) {
+        bottles.reset(stressPinCount);
+        initStressRack();
+    } else if (!rackPins.empty()) {
+        bottles.reset(rackPins.size());
+        for (const RackPin& pin : rackPins) {
+            bottles.add(pin.x, pin.y, pin.radius);
+        }
+    } else {
+        bottles.reset(StandardRack::pinCount);
+        for (const RackPin& pin : StandardRack::pins) {
+            bottles.add(pin.x, pin.y, pin.radius);
+        }
+    }
+    contacts.resize(bottles.size());
+    pairs.reserve(bottles.size() * reservedPairsPerBottle);
+    ball.visible = true; // Show the ball when bottles are reset
+    gameOver = false; // Reset game over flag
+    throws = 0; // Reset throws
+    ballInMotion = false; // Reset ball motion
+    timeSinceLastBottleDisappeared = 0.0f; // Reset timer
+}
+
+void Simulation::setStressRack(int count) {
+    stressPinCount = std::max(count, 0);
+    initBottles();
+}
+
+void Simulation::setRack(const std::vector<RackPin>& pins) {
+    rackPins = pins;
+    initBottles();
+}
+
+// Fill the deck above the ball with a staggered field of stressPinCount bottles
+void Simulation::initStressRack() {
+    const float fieldLeft = tuning.laneLeftEdge;
+    const float fieldWidth = tuning.laneRightEdge - tuning.laneLeftEdge;
+    const float fieldTop = 0.95f;
+    const float fieldHeight = 1.25f;
+
+    float spacing = std::sqrt(fieldWidth * fieldHeight / stressPinCount);
+    int columns = std::max(1, static_cast<int>(fieldWidth / spacing));
+    float radius = spacing * 0.3f;
+    for (int i = 0; i < stressPinCount; ++i) {
+        int row = i / columns;
+        int column = i % columns;
+        float offset = (row % 2) ? 0.75f : 0.25f;
+        bottles.add(fieldLeft + (column + offset) * spacing, fieldTop - row * spacing, radius);
+    }
+}
+
+void Simulation::updateBall() {
+    PROFILE_PHASE(ProfilePhase::UpdateBall);
+    ballStartX = ball.x;
+    ballStartY = ball.y;
+    if (ballInMotion) {
+        ball.y += ball.velocityY * ballTravelPerTick;
+        ball.velocityY *= ballFrictionPerTick;
+        // The ball comes back once past the pins, or once it has rolled to a
+        // stop short of them on a slow lane
+        if (ball.y > 1.0f || ball.velocityY <= tuning.sleepVelocity) {
+            ballInMotion = false;
+            ball.y = -0.8f;
+            ballStartY = ball.y; // Back at the foul line, not swept across the lane
+            ball.velocityY = 0.0f;
+            throws++;
+            if (throws >= 2) {
+                timeSinceLastBottleDisappeared = 0.0f; // Reset the timer
+            }
+        }
+    }
+}
+
+void Simulation::updateBottles() {
+    PROFILE_PHASE(ProfilePhase::UpdateBottles);
+    bool allBottlesToppled = bottles.rack().allToppled();
+    bool anyToppledBottles = bottles.rack().anyToppled(); // Hide the ball if there are any toppled bottles
+
+    if (throws == 1 && anyToppledBottles) {
+        ball.visible = false; // Hide the ball if there are toppled bottles
+    }
+
+    if (allBottlesToppled || throws >= 2) {
+        timeSinceLastBottleDisappeared += tickSeconds;
+        if (timeSinceLastBottleDisappeared > tuning.gameOverDelay) {
+            gameOver = true; // Set game over flag
+        }
+    }
+
+    // Only awake bottles move. Bottles knocked off the deck are retired and
+    // bottles that have come to rest fall asleep; walking backwards, the
+    // bottle that takes either one's place has already been updated.
+    tickCount++;
+    const float laneCentre = 0.5f * (tuning.laneLeftEdge + tuning.laneRightEdge);
+    for (std::size_t i = bottles.awakeCount(); i-- > 0;) {
+        bottles.previousX[i] = bottles.x[i];
+        bottles.previousY[i] = bottles.y[i];
+        bottles.x[i] += bottles.velocityX[i] * bottleTravelPerTick;
+        bottles.y[i] += bottles.velocityY[i] * bottleTravelPerTick;
+        bottles.velocityX[i] *= bottleDampingPerTick; // Damping
+        bottles.velocityY[i] *= bottleDampingPerTick; // Damping
+        if ((bottles.x[i] + bottles.radius[i] > tuning.laneRightEdge) ||
+            (bottles.x[i] - bottles.radius[i] < tuning.laneLeftEdge)) {
+            bottles.velocityX[i] = -bottles.velocityX[i];
+        }
+        if (bottles.toppled(i) && (std::fabs(bottles.x[i] - laneCentre) > tuning.bottleContainment || std::fabs(bottles.y[i]) > 1.0f)) {
+            bottles.remove(i);
+        } else if (std::fabs(bottles.velocityX[i]) <= tuning.sleepVelocity && std::fabs(bottles.velocityY[i]) <= tuning.sleepVelocity) {
+            // At rest: stop exactly, and stop sweeping from where it was
+            bottles.velocityX[i] = 0.0f;
+            bottles.velocityY[i] = 0.0f;
+            bottles.previousX[i] = bottles.x[i];
+            bottles.previousY[i] = bottles.y[i];
+            bottles.sleep(i);
+        }
+    }
+
+    // Retire bottles that have been down for longer than the duration, oldest
+    // first, whether awake or asleep
+    PinHandle pin;
+    while (bottles.oldestToppled(pin)) {
+        if (bottles.contains(pin)) {
+            std::size_t i = bottles.indexOf(pin);
+            if ((tickCount - bottles.toppledTick[i]) * tickSeconds <= tuning.toppledDuration) {
+                break;
+            }
+            bottles.remove(i);
+        }
+        bottles.popOldestToppled();
+    }
+
+    // If all toppled bottles are removed, reset the ball visibility
+    if (!anyToppledBottles && throws >= 1) {
+        ball.visible = true; // Show the ball again when all toppled bottles are removed
+    }
+}
+
+// Every contact knocks the bottles involved down; the rack counts each bottle
+// once. Contacts are swept over the tick, so fast balls and bottles hit what they
+// pass through even when the tick is longer than the gap between them.
+// Sleeping bottles are only tested against the ball and awake bottles, and
+// wake up once the pass is over if something hit them.
+void Simulation::handleCollisions() {
+    PROFILE_PHASE(ProfilePhase::HandleCollisions);
+    // Ball and bottle collisions
+    std::size_t count = bottles.size();
+    std::size_t hitCount = findSweptCircleContacts(bottles.previousX, bottles.previousY,
+                                                   bottles.x, bottles.y, bottles.radius, 0, count,
+                                                   ballStartX, ballStartY, ball.x, ball.y, ball.radius, contacts.data());
+    for (std::size_t h = 0; h < hitCount; ++h) {
+        std::uint32_t j = contacts[h];
+        float dx = bottles.x[j] - ball.x;
+        float dy = bottles.y[j] - ball.y;
+        float reach = bottles.radius[j] + ball.radius;
+        if (dx * dx + dy * dy >= reach * reach) {
+            float dx0 = bottles.previousX[j] - ballStartX;
+            float dy0 = bottles.previousY[j] - ballStartY;
+            impactOffset(dx0, dy0, dx - dx0, dy - dy0, reach, dx, dy);
+        }
+        pushBottle(bottles, j, dx, dy, std::fabs(ball.velocityY));
+        bottles.topple(j, tickCount);
+        bottles.requestWake(j);
+    }
+
+    // Bottle and bottle collisions. Positions do not change during this pass,
+    // so contacts can be found up front and resolved in pair order. Awake
+    // bottles come first, so every pair with an awake bottle has it first.
+    std::size_t awakeCount = bottles.awakeCount();
+    if (count > broadPhaseThreshold) {
+        grid.findPairs(bottles.previousX, bottles.previousY, bottles.x, bottles.y,
+                       bottles.radius, count, awakeCount, pairs);
+        for (const ContactPair& pair : pairs) {
+            collideBottles(pair.first, pair.second);
+        }
+        bottles.wakePending();
+        return;
+    }
+    for (std::size_t i = 0; i < awakeCount; ++i) {
+        hitCount = findSweptCircleContacts(bottles.previousX, bottles.previousY,
+                                           bottles.x, bottles.y, bottles.radius, i + 1, count,
+                                           bottles.previousX[i], bottles.previousY[i], bottles.x[i], bottles.y[i],
+                                           bottles.radius[i], contacts.data());
+        for (std::size_t h = 0; h < hitCount; ++h) {
+            collideBottles(i, contacts[h]);
+        }
+    }
+    bottles.wakePending();
+}
+
+void Simulation::collideBottles(std::size_t i, std::size_t j) {
+    float dx = bottles.x[j] - bottles.x[i];
+    float dy = bottles.y[j] - bottles.y[i];
+    float reach = bottles.radius[j] + bottles.radius[i];
+    if (dx * dx + dy * dy >= reach * reach) {
+        float dx0 = bottles.previousX[j] - bottles.previousX[i];
+        float dy0 = bottles.previousY[j] - bottles.previousY[i];
+        impactOffset(dx0, dy0, dx - dx0, dy - dy0, reach, dx, dy);
+    }
+    float speed = fastSqrt(bottles.velocityX[i] * bottles.velocityX[i] + bottles.velocityY[i] * bottles.velocityY[i]);
+    pushBottle(bottles, j, dx, dy, speed);
+    bottles.topple(i, tickCount);
+    bottles.topple(j, tickCount);
+    bottles.requestWake(j);
+}
+
+void Simulation::step() {
+    if (!gameOver) {
+        updateBall();
+        updateBottles();
+        handleCollisions();
+    }
+}
+
+void Simulation::moveLeft() {
+    if (!ballInMotion && !gameOver) {
+        ball.x -= tuning.ballMoveSpeed * tickSeconds;
+        if (ball.x - ball.radius < tuning.laneLeftEdge) {
+            ball.x = tuning.laneLeftEdge + ball.radius;
+        }
+    }
+}
+
+void Simulation::moveRight() {
+    if (!ballInMotion && !gameOver) {
+        ball.x += tuning.ballMoveSpeed * tickSeconds;
+        if (ball.x + ball.radius > tuning.laneRightEdge) {
+            ball.x = tuning.laneRightEdge - ball.radius;
+        }
+    }
+}
+
+void Simulation::increasePower() {
+    if (!ballInMotion && !gameOver) {
+        powerLevel += tuning.powerChangeRate * tickSeconds;
+        if (powerLevel >= 10) {
+            powerLevel = 10;
+        }
+    }
+}
+
+void Simulation::decreasePower() {
+    if (!ballInMotion && !gameOver) {
+        powerLevel -= tuning.powerChangeRate * tickSeconds;
+        if (powerLevel <= 0) {
+            powerLevel = 0;
+        }
+    }
+}
+
+void Simulation::throwBall() {
+    if (!ballInMotion && !gameOver) {
+        ball.velocityY = tuning.ballLaunchSpeed * ((powerLevel + 1) / 10);
+        ballInMotion = true;
+    }
+}
+
+void Simulation::reset() {
+    powerLevel = 0;
+    initBottles();
+}
+
+void Simulation::applyInput(const InputState& input) {
+    if (input.throwBall) {
+        throwBall();
+    }
+    if (input.left) {
+        moveLeft();
+    }
+    if (input.right) {
+        moveRight();
+    }
+    if (input.powerUp) {
+        increasePower();
+    }
+    if (input.powerDown) {
+        decreasePower();
+    }
+    if (input.reset) {
+        reset();
+    }
+}
+
+ThrowResult Simulation::simulateThrow(float x, float power) {
+    TRACE_SPAN("simulateThrow");
+    reset();
+    return playThrow(x, power);
+}
+
+ThrowResult Simulation::evaluateThrow(float x, float power) {
+    TRACE_SPAN("evaluateThrow");
+    whatIf.resize(snapshotSize());
+    saveSnapshot(whatIf.data());
+    ThrowResult result = playThrow(x, power);
+    restoreSnapshot(whatIf.data());
+    return result;
+}
+
+ThrowResult Simulation::playThrow(float x, float power) {
+    ball.x = std::min(std::max(x, tuning.laneLeftEdge + ball.radius), tuning.laneRightEdge - ball.radius);
+    ball.y = -0.8f;
+    ball.velocityY = 0.0f;
+    powerLevel = std::min(std::max(power, 0.0f), 10.0f);
+    throwBall();
+
+    // A stalled ball ends the throw by itself; the cap is for tunings that
+    // take minutes to roll to a stop
+    int steps = 0;
+    int maxBallSteps = static_cast<int>(maxBallTime / tickSeconds);
+    while (ballInMotion && !gameOver && steps < maxBallSteps) {
+        step();
+        steps++;
+    }
+
+    // Let knocked bottles finish tumbling into their neighbours
+    int maxSettleSteps = static_cast<int>(maxSettleTime / tickSeconds);
+    for (int i = 0; i < maxSettleSteps; ++i) {
+        if (bottles.awakeCount() == 0 || gameOver) {
+            break;
+        }
+        step();
+        steps++;
+    }
+
+    return {totalToppled(), steps, bottles.rack().pinMask};
+}
+
+void Simulation::saveState(std::vector<std::uint8_t>& bytes) const {
+    ByteWriter writer = {bytes};
+    writer.f32(ball.x);
+    writer.f32(ball.y);
+    writer.f32(ball.radius);
+    writer.f32(ball.velocityX);
+    writer.f32(ball.velocityY);
+    writer.fixed(ball.visible, 1);
+    writer.varint(static_cast<std::uint64_t>(throws));
+    writer.fixed(ballInMotion, 1);
+    writer.fixed(gameOver, 1);
+    writer.f32(powerLevel);
+    writer.f32(timeSinceLastBottleDisappeared);
+    writer.varint(static_cast<std::uint64_t>(stressPinCount));
+    writer.f32(ballStartX);
+    writer.f32(ballStartY);
+    writer.fixed(tickCount, 4);
+    bottles.save(writer);
+}
+
+bool Simulation::loadState(const std::uint8_t* data, std::size_t size) {
+    ByteReader reader = {data, size};
+    ball.x = reader.f32();
+    ball.y = reader.f32();
+    ball.radius = reader.f32();
+    ball.velocityX = reader.f32();
+    ball.velocityY = reader.f32();
+    ball.visible = reader.fixed(1) != 0;
+    throws = static_cast<int>(reader.varint());
+    ballInMotion = reader.fixed(1) != 0;
+    gameOver = reader.fixed(1) != 0;
+    powerLevel = reader.f32();
+    timeSinceLastBottleDisappeared = reader.f32();
+    stressPinCount = static_cast<int>(reader.varint());
+    ballStartX = reader.f32();
+    ballStartY = reader.f32();
+    tickCount = static_cast<std::uint32_t>(reader.fixed(4));
+    if (!reader.ok || !bottles.load(reader)) {
+        return false;
+    }
+    contacts.resize(std::max(contacts.size(), bottles.size()));
+    return true;
+}
+
+std::size_t Simulation::snapshotSize() const {
+    return scalarStateSize + bottles.arenaSize();
+}
+
+void Simulation::saveSnapshot(std::uint8_t* data) const {
+    ScalarState state = {ball, throws, ballInMotion, gameOver, powerLevel, timeSinceLastBottleDisappeared,
+                         stressPinCount, ballStartX, ballStartY, tickCount,
+                         static_cast<std::uint32_t>(bottles.capacity())};
+    std::memcpy(data, &state, sizeof(state));
+    std::memcpy(data + scalarStateSize, bottles.arenaData(), bottles.arenaSize());
+}
+
+void Simulation::restoreSnapshot(const std::uint8_t* data) {
+    ScalarState state;
+    std::memcpy(&state, data, sizeof(state));
+    ball = state.ball;
+    throws = state.throws;
+    ballInMotion = state.ballInMotion;
+    gameOver = state.gameOver;
+    powerLevel = state.powerLevel;
+    timeSinceLastBottleDisappeared = state.timeSinceLastBottleDisappeared;
+    stressPinCount = state.stressPinCount;
+    ballStartX = state.ballStartX;
+    ballStartY = state.ballStartY;
+    tickCount = state.tickCount;
+    bottles.restoreArena(data + scalarStateSize, state.bottleCapacity);
+    contacts.resize(std::max(contacts.size(), bottles.capacity()));
+}
+
+void Simulation::simulateBatch(const Throw* batch, std::size_t count, ThrowResult* results) {
+    for (std::size_t i = 0; i < count; ++i) {
+        results[i] = simulateThrow(batch[i].x, batch[i].power);
+    }
+}
+
+std::vector<ThrowResult> Simulation::simulateBatch(const std::vector<Throw>& batch) {
+    std::vector<ThrowResult> results(batch.size());
+    simulateBatch(batch.data(), batch.size(), results.data());
+    return results;
+}
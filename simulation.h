@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "broad_phase.h"
+#include "pin_store.h"
+#include "rack_layout.h"
+
+// Ball properties
+struct Ball {
+    float x, y;
+    float radius;
+    float velocityX, velocityY;
+    bool visible;
+};
+
+// Above this many bottles the bottle-bottle pass uses the uniform grid
+// instead of testing every pair
+const std::size_t broadPhaseThreshold = 64;
+
+// Physics runs on a fixed tick, independent of the display refresh rate.
+const double defaultTickRate = 120.0;
+const float referenceFrameRate = 60.0f;
+
+// Gameplay tuning and lane geometry. Motion constants are per second; the
+// damping factors were tuned against the original 60 frames-per-second loop
+// and are rescaled to the tick. Replays carry the values they were recorded
+// with, and level files (level_library.h) can set any of them.
+struct Tuning {
+    float ballLaunchSpeed = 1.8f; // Lane units per second, scaled by (power + 1) / 10
+    float ballFriction = 0.999f; // Ball velocity kept per reference frame
+    float bottleDamping = 0.7f; // Bottle velocity kept per reference frame
+    float ballMoveSpeed = 0.6f; // Lane units per second while steering
+    float powerChangeRate = 3.0f; // Power levels per second while adjusting
+    float toppledDuration = 3.0f; // Time in seconds before a toppled bottle disappears
+    float gameOverDelay = 3.0f; // Seconds from the last throw to the final score
+    float sleepVelocity = 6e-5f; // Bottles this slow on both axes (units per second) are at rest and fall asleep
+    float laneLeftEdge = -0.5f; // The ball and bottles stay between the edges
+    float laneRightEdge = 0.5f;
+    // Toppled bottles further than this from the lane's centre line, midway
+    // between the edges, are retired
+    float bottleContainment = 0.4f;
+};
+
+// A single throw: where the ball is released and with how much power (0 - 10)
+struct Throw {
+    float x;
+    float power;
+};
+
+// Outcome of a simulated throw
+struct ThrowResult {
+    int toppled; // Bottles toppled by the throw
+    int steps;   // Simulation steps until the rack settled
+    std::uint16_t pinMask; // Rack pins knocked down, bit n for pin n
+};
+
+// Controls held during a tick
+struct InputState {
+    bool left, right;
+    bool powerUp, powerDown;
+    bool throwBall;
+    bool reset;
+};
+
+// Self-contained game state and physics. Holds no globals and touches no GL,
+// so any number of instances can run side by side (e.g. one per thread).
+class Simulation {
+public:
+    explicit Simulation(double tickRate = defaultTickRate, const Tuning& tuning = Tuning());
+
+    void initBottles();
+    // Replace the 10-pin rack with a field of count bottles (0 restores the
+    // normal rack). The field is rebuilt on every reset.
+    void setStressRack(int count);
+    // Replace the 10-pin rack with pins (none restores the normal rack), set
+    // again on every reset. A stress rack takes precedence.
+    void setRack(const std::vector<RackPin>& pins);
+    // The pins set by setRack; empty for the normal rack
+    const std::vector<RackPin>& customRack() const { return rackPins; }
+    void updateBall();
+    void updateBottles();
+    void handleCollisions();
+
+    // Advance the game by one tick
+    void step();
+
+    // Player actions, mirroring the keyboard controls. Steering and power
+    // are held actions and move by one tick's worth per call.
+    void moveLeft();
+    void moveRight();
+    void increasePower();
+    void decreasePower();
+    void throwBall();
+    void reset();
+    // Apply every held control for one tick, in the keyboard's order
+    void applyInput(const InputState& input);
+
+    // Play a single throw on a fresh rack and report how many bottles fell
+    ThrowResult simulateThrow(float x, float power);
+    // Play a throw from the current state, e.g. at what is left standing
+    // after the first ball, then roll back as if it never happened. Toppled
+    // counts include bottles already down.
+    ThrowResult evaluateThrow(float x, float power);
+    // Evaluate count throws, writing one result per throw
+    void simulateBatch(const Throw* batch, std::size_t count, ThrowResult* results);
+    std::vector<ThrowResult> simulateBatch(const std::vector<Throw>& batch);
+
+    Tuning tuning;
+    // Tick length and per-tick damping derived from it
+    float tickSeconds;
+    float ballFrictionPerTick;
+    float bottleDampingPerTick;
+    // Distance moved per tick per unit of velocity. Follows the damping
+    // curve rather than velocity * tickSeconds, so a ball or bottle glides
+    // as far at any tick rate as it did in the 60 FPS loop.
+    float ballTravelPerTick;
+    float bottleTravelPerTick;
+
+    // Game state
+    Ball ball;
+    PinStore bottles;
+    int throws;
+    bool ballInMotion;
+    bool gameOver;
+    float powerLevel;
+    float timeSinceLastBottleDisappeared; // Time since the last bottle disappeared
+
+    // Bottles knocked down since the rack was set
+    int totalToppled() const { return static_cast<int>(bottles.rack().knockedDown()); }
+
+    // Full game state between ticks, for replay keyframes: restoring it on a
+    // simulation with the same tick rate and tuning, then stepping, matches
+    // the original bit for bit. Loading returns false on malformed data.
+    void saveState(std::vector<std::uint8_t>& bytes) const;
+    bool loadState(const std::uint8_t* data, std::size_t size);
+
+    // The same state as raw memory, for cheap rollback within one process:
+    // a snapshot is two memcpys, of the scalar state and of the bottles'
+    // arena. The size depends on the bottle capacity, so it only changes
+    // when the rack does. Restoring needs the same tick rate and tuning.
+    std::size_t snapshotSize() const;
+    void saveSnapshot(std::uint8_t* data) const;
+    void restoreSnapshot(const std::uint8_t* data);
+
+private:
+    // Every field saveState covers apart from the bottles, as plain data
+    struct ScalarState {
+        Ball ball;
+        int throws;
+        bool ballInMotion;
+        bool gameOver;
+        float powerLevel;
+        float timeSinceLastBottleDisappeared;
+        int stressPinCount;
+        float ballStartX, ballStartY;
+        std::uint32_t tickCount;
+        std::uint32_t bottleCapacity;
+    };
+    // Bottles start on the next cache line after the scalar state
+    static const std::size_t scalarStateSize = (sizeof(ScalarState) + 63) / 64 * 64;
+
+    void initStressRack();
+    // Throw at x with power from the current state and run until the rack settles
+    ThrowResult playThrow(float x, float power);
+    void collideBottles(std::size_t i, std::size_t j);
+
+    int stressPinCount;
+    std::vector<RackPin> rackPins;
+
+    // Ball position at the start of the tick, for swept collision tests
+    float ballStartX, ballStartY;
+    // Ticks of bottle movement simulated, for timing toppled bottles
+    std::uint32_t tickCount;
+
+    // Scratch space for collision results, reused every tick
+    std::vector<std::uint32_t> contacts;
+    std::vector<ContactPair> pairs;
+    UniformGrid grid;
+    // Snapshot taken by evaluateThrow
+    std::vector<std::uint8_t> whatIf;
+};
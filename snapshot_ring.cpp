@@ -0,0 +1,32 @@
+#include "snapshot_ring.h"
+
+#include <algorithm>
+
+SnapshotRing::SnapshotRing(std::size_t slots, std::size_t snapshotBytes)
+    : storage(std::max<std::size_t>(slots, 1) * snapshotBytes), slotCount(std::max<std::size_t>(slots, 1)),
+      snapshotBytes(snapshotBytes) {}
+
+bool SnapshotRing::push(const Simulation& simulation) {
+    if (simulation.snapshotSize() > snapshotBytes) {
+        return false;
+    }
+    newest = count == 0 ? 0 : (newest + 1) % slotCount;
+    count = std::min(count + 1, slotCount);
+    simulation.saveSnapshot(storage.data() + newest * snapshotBytes);
+    return true;
+}
+
+bool SnapshotRing::restore(std::size_t age, Simulation& simulation) const {
+    if (age >= count) {
+        return false;
+    }
+    std::size_t slot = (newest + slotCount - age) % slotCount;
+    simulation.restoreSnapshot(storage.data() + slot * snapshotBytes);
+    return true;
+}
+
+void SnapshotRing::discard(std::size_t dropped) {
+    dropped = std::min(dropped, count);
+    count -= dropped;
+    newest = (newest + slotCount - dropped) % slotCount;
+}
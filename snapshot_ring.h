@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "simulation.h"
+
+// The last few simulation snapshots, for rolling a game back a number of
+// ticks. Storage is allocated once up front; pushing overwrites the oldest
+// snapshot once the ring is full, and neither pushing nor restoring
+// allocates unless the rack's capacity changed.
+class SnapshotRing {
+public:
+    // slots snapshots of up to snapshotBytes each (Simulation::snapshotSize)
+    SnapshotRing(std::size_t slots, std::size_t snapshotBytes);
+
+    // Snapshot simulation as the newest entry. Returns false, keeping
+    // nothing, if its snapshot is larger than a slot.
+    bool push(const Simulation& simulation);
+    // Restore the snapshot age pushes back (0 is the newest)
+    bool restore(std::size_t age, Simulation& simulation) const;
+    // Forget the newest count snapshots, e.g. the ones rolled back past
+    void discard(std::size_t count);
+    void clear() { count = 0; }
+
+    std::size_t size() const { return count; }
+    std::size_t slots() const { return slotCount; }
+    std::size_t slotBytes() const { return snapshotBytes; }
+
+private:
+    std::vector<std::uint8_t> storage;
+    std::size_t slotCount;
+    std::size_t snapshotBytes;
+    std::size_t newest = 0;
+    std::size_t count = 0;
+};
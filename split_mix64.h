@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "fast_math.h"
+
+// Small, fast, seedable generator; cheap enough to keep one per aim point or lane
+struct SplitMix64 {
+    std::uint64_t state;
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in (0, 1]
+    double uniform() {
+        return (static_cast<double>(next() >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform in [low, high]
+    float uniform(float low, float high) {
+        return low + (high - low) * static_cast<float>(uniform());
+    }
+
+    // Standard normal pair via Box-Muller, with the radius and angle taken
+    // through the deterministic log and sincos so samples do not shift with
+    // the libm version
+    void gaussianPair(double& a, double& b) {
+        const double twoPi = 6.283185307179586;
+        double radius = std::sqrt(-2.0 * fastLog(uniform()));
+        float sine, cosine;
+        fastSinCos(static_cast<float>(twoPi * uniform()), sine, cosine);
+        a = radius * cosine;
+        b = radius * sine;
+    }
+};
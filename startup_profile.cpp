@@ -0,0 +1,32 @@
+#include "startup_profile.h"
+
+#include "trace.h"
+
+StartupProfile::StartupProfile() : start(traceNow()), phases(), count(0) {}
+
+void StartupProfile::mark(const char* name) {
+    if (count == maxPhases) {
+        return;
+    }
+    std::int64_t now = traceNow();
+    std::int64_t begin = count > 0 ? phases[count - 1].end : start;
+    if (traceEnabled()) {
+        recordTraceSpan(name, begin, now);
+    }
+    phases[count++] = {name, now};
+}
+
+double StartupProfile::totalMs() const {
+    return count > 0 ? (phases[count - 1].end - start) / 1e6 : 0.0;
+}
+
+void StartupProfile::print(std::FILE* file) const {
+    std::fprintf(file, "Startup phase            ms   total ms\n");
+    std::int64_t begin = start;
+    for (int phase = 0; phase < count; ++phase) {
+        std::fprintf(file, "  %-18s %8.3f %10.3f\n", phases[phase].name, (phases[phase].end - begin) / 1e6,
+                     (phases[phase].end - start) / 1e6);
+        begin = phases[phase].end;
+    }
+    std::fprintf(file, "  total %.3f ms\n", totalMs());
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+// Wall-clock time of each step from main() to the first frame on screen.
+// Phases run back to back: mark(name) ends the phase called name, which
+// began at the previous mark. Phases are also recorded as trace spans while
+// tracing is on. Time spent loading the executable before main() is not
+// included.
+class StartupProfile {
+public:
+    static const int maxPhases = 32;
+
+    StartupProfile();
+
+    // End the current phase and start the next. Marks past maxPhases are dropped.
+    void mark(const char* name);
+
+    // Milliseconds from construction to the last mark
+    double totalMs() const;
+
+    // One line per phase with its own and cumulative time
+    void print(std::FILE* file) const;
+
+private:
+    struct Phase {
+        const char* name; // A literal
+        std::int64_t end;
+    };
+
+    std::int64_t start;
+    Phase phases[maxPhases];
+    int count;
+};
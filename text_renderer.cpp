@@ -0,0 +1,139 @@
+#include "text_renderer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#ifndef GL_R8
+#define GL_R8 0x8229
+#endif
+
+namespace {
+
+// Glyphs a frame can queue before the vertex batch has to grow: the HUD
+// plus the profiler overlay
+const std::size_t reservedGlyphs = 1024;
+
+const char* vertexShaderSource = R"(#version 330 core
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 atlasCoord;
+layout(location = 2) in vec4 vertexColor;
+out vec2 uv;
+out vec4 color;
+void main() {
+    gl_Position = vec4(position, 0.0, 1.0);
+    uv = atlasCoord;
+    color = vertexColor;
+}
+)";
+
+const char* fragmentShaderSource = R"(#version 330 core
+uniform sampler2D atlas;
+in vec2 uv;
+in vec4 color;
+out vec4 fragColor;
+void main() {
+    fragColor = vec4(color.rgb, color.a * texture(atlas, uv).r);
+}
+)";
+
+}
+
+bool TextRenderer::init(const GlFunctions* functions, const std::uint8_t* atlasPixels) {
+    gl = functions;
+    vertices.reserve(reservedGlyphs * 6);
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    if (gl) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, atlasPixels);
+    } else {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, atlasWidth, atlasHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, atlasPixels);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (!gl) {
+        return true;
+    }
+
+    program = buildShaderProgram(*gl, vertexShaderSource, fragmentShaderSource);
+    if (!program) {
+        return false;
+    }
+
+    gl->genVertexArrays(1, &vertexArray);
+    gl->bindVertexArray(vertexArray);
+    gl->genBuffers(1, &vertexBuffer);
+    gl->bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    gl->enableVertexAttribArray(0);
+    gl->vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex),
+                            reinterpret_cast<const void*>(offsetof(TextVertex, x)));
+    gl->enableVertexAttribArray(1);
+    gl->vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex),
+                            reinterpret_cast<const void*>(offsetof(TextVertex, u)));
+    gl->enableVertexAttribArray(2);
+    gl->vertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TextVertex),
+                            reinterpret_cast<const void*>(offsetof(TextVertex, color)));
+    gl->bindVertexArray(0);
+    gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void TextRenderer::setFramebufferSize(int width, int height) {
+    framebufferWidth = std::max(width, 1);
+    framebufferHeight = std::max(height, 1);
+}
+
+void TextRenderer::add(float x, float y, const char* text, std::size_t length, Color color) {
+    appendTextVertices(x, y, text, length, color, framebufferWidth, framebufferHeight, vertices);
+}
+
+void TextRenderer::add(float x, float y, const char* text, Color color) {
+    add(x, y, text, std::strlen(text), color);
+}
+
+void TextRenderer::flush() {
+    if (vertices.empty()) {
+        return;
+    }
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    if (gl) {
+        // Orphan last frame's storage so the upload does not wait on the GPU
+        gl->bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        vertexCapacity = std::max(vertices.size(), vertexCapacity);
+        gl->bufferData(GL_ARRAY_BUFFER, vertexCapacity * sizeof(TextVertex), nullptr, GL_STREAM_DRAW);
+        gl->bufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(TextVertex), vertices.data());
+
+        gl->useProgram(program);
+        gl->bindVertexArray(vertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
+        gl->bindVertexArray(0);
+        gl->useProgram(0);
+        gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+    } else {
+        const TextVertex* first = vertices.data();
+        glEnable(GL_TEXTURE_2D);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        glVertexPointer(2, GL_FLOAT, sizeof(TextVertex), &first->x);
+        glTexCoordPointer(2, GL_FLOAT, sizeof(TextVertex), &first->u);
+        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &first->color);
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glDisable(GL_TEXTURE_2D);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_BLEND);
+    vertices.clear();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gl_functions.h"
+#include "glyph_atlas.h"
+
+// Batched bitmap text. Strings are queued with add() and the whole batch is
+// drawn from the glyph atlas texture with a single draw call in flush().
+class TextRenderer {
+public:
+    // Upload the atlas, as baked by bakeGlyphAtlas. With GL 3.3 functions the
+    // batch is drawn through a shader, otherwise through fixed-function
+    // vertex arrays.
+    bool init(const GlFunctions* functions, const std::uint8_t* atlasPixels);
+
+    void setFramebufferSize(int width, int height);
+
+    // Queue text with its baseline starting at (x, y)
+    void add(float x, float y, const char* text, std::size_t length, Color color = colorWhite);
+    void add(float x, float y, const char* text, Color color = colorWhite);
+
+    // Draw everything queued since the last flush
+    void flush();
+
+private:
+    const GlFunctions* gl = nullptr;
+    GLuint texture = 0;
+    GLuint program = 0;
+    GLuint vertexArray = 0;
+    GLuint vertexBuffer = 0;
+    std::size_t vertexCapacity = 0;
+    int framebufferWidth = 1;
+    int framebufferHeight = 1;
+    std::vector<TextVertex> vertices;
+};
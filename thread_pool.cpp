@@ -0,0 +1,123 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+#include "trace.h"
+
+ThreadPool::ThreadPool(int threadCount) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    workerCount = threadCount;
+    queues.reset(new Queue[workerCount]);
+    for (int worker = 1; worker < workerCount; ++worker) {
+        threads.emplace_back(&ThreadPool::workerLoop, this, worker);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::run(std::size_t count, std::size_t grain, RangeFunction function, void* body) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    if (workerCount == 1 || count <= grain) {
+        function(body, 0, count, 0);
+        return;
+    }
+
+    // Publish the job before any range becomes visible: a worker still
+    // draining the previous job may pick up the new ranges straight away
+    std::size_t rangeCount = (count + grain - 1) / grain;
+    jobFunction = function;
+    jobBody = body;
+    pendingRanges.store(rangeCount);
+
+    // Deal the ranges out round-robin so every worker starts with local work
+    for (int worker = 0; worker < workerCount; ++worker) {
+        Queue& queue = queues[worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.clear();
+        queue.head = 0;
+    }
+    for (std::size_t i = 0; i < rangeCount; ++i) {
+        Queue& queue = queues[i % workerCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.push_back({i * grain, std::min(count, (i + 1) * grain)});
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        jobGeneration++;
+    }
+    jobReady.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(jobMutex);
+    jobDone.wait(lock, [this] { return pendingRanges.load() == 0; });
+}
+
+void ThreadPool::workerLoop(int worker) {
+    setTraceThreadName("worker", worker);
+    std::uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(jobMutex);
+            jobReady.wait(lock, [&] { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = jobGeneration;
+        }
+        drain(worker);
+    }
+}
+
+// Run ranges until there is nothing left to take or steal
+void ThreadPool::drain(int worker) {
+    Range range;
+    while (popOwn(worker, range) || steal(worker, range)) {
+        {
+            TRACE_SPAN("range");
+            jobFunction(jobBody, range.begin, range.end, worker);
+        }
+        if (pendingRanges.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            jobDone.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::popOwn(int worker, Range& range) {
+    Queue& queue = queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.ranges.size() == queue.head) {
+        return false;
+    }
+    range = queue.ranges.back();
+    queue.ranges.pop_back();
+    return true;
+}
+
+bool ThreadPool::steal(int worker, Range& range) {
+    for (int offset = 1; offset < workerCount; ++offset) {
+        Queue& queue = queues[(worker + offset) % workerCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.ranges.size() > queue.head) {
+            range = queue.ranges[queue.head++];
+            return true;
+        }
+    }
+    return false;
+}
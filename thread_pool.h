@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed set of worker threads running data-parallel loops. Each worker owns
+// a queue of index ranges, takes work from the back of its own queue and,
+// once that is empty, steals from the front of the others, so uneven work
+// (throws that roll longer, lanes that are busier) balances itself out.
+// The calling thread joins in as worker 0.
+class ThreadPool {
+public:
+    // 0 threads means one per hardware thread
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Workers, including the calling thread
+    int size() const { return workerCount; }
+
+    // Call body(begin, end, worker) over [0, count) in ranges of at most
+    // grain indices, returning once every range is done. worker is in
+    // [0, size()) and no two ranges run on the same worker at once, so it
+    // can index per-worker scratch state.
+    template <typename Body>
+    void parallelFor(std::size_t count, std::size_t grain, Body&& body) {
+        run(count, grain, &invokeBody<typename std::remove_reference<Body>::type>, &body);
+    }
+
+private:
+    using RangeFunction = void (*)(void* body, std::size_t begin, std::size_t end, int worker);
+
+    struct Range {
+        std::size_t begin, end;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::vector<Range> ranges;
+        std::size_t head = 0; // Thieves take from here, the owner from the back
+    };
+
+    template <typename Body>
+    static void invokeBody(void* body, std::size_t begin, std::size_t end, int worker) {
+        (*static_cast<Body*>(body))(begin, end, worker);
+    }
+
+    void run(std::size_t count, std::size_t grain, RangeFunction function, void* body);
+    void workerLoop(int worker);
+    void drain(int worker);
+    bool popOwn(int worker, Range& range);
+    bool steal(int worker, Range& range);
+
+    int workerCount;
+    std::vector<std::thread> threads;
+    std::unique_ptr<Queue[]> queues;
+
+    std::mutex jobMutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    std::uint64_t jobGeneration = 0;
+    bool stopping = false;
+    RangeFunction jobFunction = nullptr;
+    void* jobBody = nullptr;
+    std::atomic<std::size_t> pendingRanges{0};
+};
@@ -0,0 +1,511 @@
+#include "tournament_server.h"
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "lane.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+namespace {
+
+const std::size_t lanesPerRange = 8;
+const int maxEvents = 256;
+const std::size_t readChunk = 64 * 1024;
+const std::size_t maxLineLength = 256; // Longer lines are a broken client
+
+volatile std::sig_atomic_t stopRequested = 0;
+
+void requestStop(int) {
+    stopRequested = 1;
+}
+
+struct QueuedInput {
+    InputState input;
+    int ticks;
+};
+
+struct LaneEvent {
+    bool gameOver; // Otherwise a finished throw
+    int throwNumber;
+    int toppled;
+    std::uint16_t pinMask;
+};
+
+// A lane played by a client, with the input it has sent but not yet played
+struct ServerLane {
+    ServerLane(double tickRate, int stressPins, int owner, const Level& level)
+        : lane(tickRate, stressPins, 0, false, level), owner(owner), lastThrows(0), lastGameOver(false) {}
+
+    // Whether the lane has anything to simulate without more input
+    bool settling() const {
+        const Simulation& game = lane.simulation;
+        return !game.gameOver && (game.ballInMotion || game.bottles.awakeCount() > 0 || game.throws >= 2 ||
+                                  game.bottles.rack().allToppled());
+    }
+    bool busy() const { return inputHead < inputs.size() || settling(); }
+
+    // Run up to ticks ticks, stopping early once the lane waits on its client
+    void run(int ticks) {
+        for (int tick = 0; tick < ticks; ++tick) {
+            InputState input = {};
+            if (inputHead < inputs.size()) {
+                input = inputs[inputHead].input;
+                if (--inputs[inputHead].ticks <= 0) {
+                    inputHead++;
+                }
+            } else if (!settling()) {
+                break;
+            }
+            lane.tick(input);
+            ticksRun++;
+            noteEvents();
+        }
+        if (inputHead == inputs.size()) {
+            inputs.clear();
+            inputHead = 0;
+        }
+    }
+
+    void noteEvents() {
+        const Simulation& game = lane.simulation;
+        if (game.throws != lastThrows) {
+            if (game.throws > lastThrows) {
+                events.push_back({false, game.throws, game.totalToppled(), game.bottles.rack().pinMask});
+            }
+            lastThrows = game.throws;
+        }
+        if (game.gameOver != lastGameOver) {
+            if (game.gameOver) {
+                events.push_back({true, game.throws, game.totalToppled(), game.bottles.rack().pinMask});
+            }
+            lastGameOver = game.gameOver;
+        }
+    }
+
+    Lane lane;
+    int owner; // Connection fd, or -1 once closed
+    std::vector<QueuedInput> inputs;
+    std::size_t inputHead = 0;
+    std::vector<LaneEvent> events;
+    int lastThrows;
+    bool lastGameOver;
+    std::uint64_t ticksRun = 0;
+};
+
+struct Connection {
+    std::string input;
+    std::string output;
+    std::size_t outputSent = 0;
+    bool waitingToWrite = false; // Registered for EPOLLOUT
+    std::vector<std::uint32_t> lanes;
+};
+
+class TournamentServer {
+public:
+    explicit TournamentServer(const TournamentSettings& settings)
+        : settings(settings), pool(settings.threads) {}
+
+    ~TournamentServer() {
+        for (auto& entry : connections) {
+            close(entry.first);
+        }
+        if (listenFd >= 0) {
+            close(listenFd);
+            unlink(settings.socketPath);
+        }
+        if (epollFd >= 0) {
+            close(epollFd);
+        }
+    }
+
+    bool listen();
+    void serve();
+    void printStats(double seconds, double cpuSeconds) const;
+
+private:
+    void acceptClients();
+    void readClient(int fd);
+    void writeClient(int fd, Connection& connection);
+    void dropClient(int fd);
+    void handleLine(int fd, Connection& connection, char* line);
+    ServerLane* ownedLane(int fd, const char* id);
+    void stepLanes();
+    void sendEvents();
+
+    const TournamentSettings& settings;
+    const Level standardLevel; // For lanes opened without a level
+    ThreadPool pool;
+    int listenFd = -1;
+    int epollFd = -1;
+    std::unordered_map<int, Connection> connections;
+
+    std::vector<ServerLane> lanes;
+    std::vector<std::uint32_t> freeLanes;
+    std::vector<std::uint32_t> busyLanes; // Scratch, rebuilt every batch
+
+    std::uint64_t gamesFinished = 0;
+    std::uint64_t throwsFinished = 0;
+    std::uint64_t ticksRun = 0;
+};
+
+bool TournamentServer::listen() {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (std::strlen(settings.socketPath) >= sizeof(address.sun_path)) {
+        std::fprintf(stderr, "Socket path too long: %s\n", settings.socketPath);
+        return false;
+    }
+    std::strcpy(address.sun_path, settings.socketPath);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) {
+        std::perror("socket");
+        return false;
+    }
+    unlink(settings.socketPath); // Left over from a server that did not shut down cleanly
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        ::listen(listenFd, SOMAXCONN) < 0) {
+        std::perror(settings.socketPath);
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    if (epollFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event) < 0) {
+        std::perror("epoll");
+        return false;
+    }
+    return true;
+}
+
+void TournamentServer::serve() {
+    epoll_event events[maxEvents];
+    while (!stopRequested) {
+        // Block only when every lane is waiting on its client
+        bool anyBusy = std::any_of(lanes.begin(), lanes.end(),
+                                   [](const ServerLane& lane) { return lane.owner >= 0 && lane.busy(); });
+        int ready = epoll_wait(epollFd, events, maxEvents, anyBusy ? 0 : -1);
+        if (ready < 0 && errno != EINTR) {
+            std::perror("epoll_wait");
+            return;
+        }
+        for (int i = 0; i < ready; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == listenFd) {
+                acceptClients();
+                continue;
+            }
+            auto found = connections.find(fd);
+            if (found == connections.end()) {
+                continue;
+            }
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readClient(fd);
+            } else if (events[i].events & EPOLLOUT) {
+                writeClient(fd, found->second);
+            }
+        }
+
+        stepLanes();
+        sendEvents();
+    }
+}
+
+void TournamentServer::acceptClients() {
+    for (;;) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            continue;
+        }
+        connections[fd];
+    }
+}
+
+void TournamentServer::readClient(int fd) {
+    char buffer[readChunk];
+    for (;;) {
+        ssize_t received = read(fd, buffer, sizeof(buffer));
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received < 0 && errno == EAGAIN) {
+            break;
+        }
+        if (received <= 0) {
+            dropClient(fd);
+            return;
+        }
+
+        Connection& connection = connections[fd];
+        connection.input.append(buffer, static_cast<std::size_t>(received));
+        std::size_t lineStart = 0;
+        for (;;) {
+            std::size_t lineEnd = connection.input.find('\n', lineStart);
+            if (lineEnd == std::string::npos) {
+                break;
+            }
+            connection.input[lineEnd] = '\0';
+            handleLine(fd, connection, &connection.input[lineStart]);
+            lineStart = lineEnd + 1;
+        }
+        connection.input.erase(0, lineStart);
+        if (connection.input.size() > maxLineLength) {
+            dropClient(fd);
+            return;
+        }
+    }
+}
+
+void TournamentServer::writeClient(int fd, Connection& connection) {
+    while (connection.outputSent < connection.output.size()) {
+        ssize_t sent = send(fd, connection.output.data() + connection.outputSent,
+                            connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN) {
+                dropClient(fd);
+                return;
+            }
+            break;
+        }
+        connection.outputSent += static_cast<std::size_t>(sent);
+    }
+    if (connection.outputSent == connection.output.size()) {
+        connection.output.clear();
+        connection.outputSent = 0;
+    }
+
+    // Ask for EPOLLOUT only while the socket is backed up
+    bool backedUp = !connection.output.empty();
+    if (backedUp != connection.waitingToWrite) {
+        epoll_event event = {};
+        event.events = backedUp ? EPOLLIN | EPOLLOUT : EPOLLIN;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event);
+        connection.waitingToWrite = backedUp;
+    }
+}
+
+void TournamentServer::dropClient(int fd) {
+    auto found = connections.find(fd);
+    if (found == connections.end()) {
+        return;
+    }
+    for (std::uint32_t id : found->second.lanes) {
+        lanes[id].owner = -1;
+        freeLanes.push_back(id);
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(found);
+}
+
+ServerLane* TournamentServer::ownedLane(int fd, const char* id) {
+    char* end = nullptr;
+    unsigned long index = id ? std::strtoul(id, &end, 10) : 0;
+    if (!id || *end != '\0' || index >= lanes.size() || lanes[index].owner != fd) {
+        return nullptr;
+    }
+    return &lanes[index];
+}
+
+void TournamentServer::handleLine(int fd, Connection& connection, char* line) {
+    char* save = nullptr;
+    const char* command = strtok_r(line, " \t\r", &save);
+    if (!command) {
+        return;
+    }
+    char reply[64];
+    if (std::strcmp(command, "open") == 0) {
+        const char* levelName = strtok_r(nullptr, " \t\r", &save);
+        const Level* level = &standardLevel;
+        if (levelName) {
+            auto found = std::find_if(settings.levels.begin(), settings.levels.end(),
+                                      [&](const Level& candidate) { return candidate.name == levelName; });
+            if (found == settings.levels.end()) {
+                connection.output.append("error no such level\n");
+                return;
+            }
+            level = &*found;
+        }
+        std::uint32_t id;
+        if (!freeLanes.empty()) {
+            id = freeLanes.back();
+            freeLanes.pop_back();
+            lanes[id] = ServerLane(settings.tickRate, settings.stressPins, fd, *level);
+        } else {
+            id = static_cast<std::uint32_t>(lanes.size());
+            lanes.emplace_back(settings.tickRate, settings.stressPins, fd, *level);
+        }
+        connection.lanes.push_back(id);
+        int length = std::snprintf(reply, sizeof(reply), "lane %u %g\n", id, settings.tickRate);
+        connection.output.append(reply, length);
+    } else if (std::strcmp(command, "input") == 0) {
+        ServerLane* lane = ownedLane(fd, strtok_r(nullptr, " \t\r", &save));
+        const char* keys = strtok_r(nullptr, " \t\r", &save);
+        const char* ticks = strtok_r(nullptr, " \t\r", &save);
+        if (!lane || !keys) {
+            connection.output.append("error bad input\n");
+            return;
+        }
+        QueuedInput queued = {{}, ticks ? std::max(1, std::atoi(ticks)) : 1};
+        for (const char* key = keys; *key; ++key) {
+            switch (*key) {
+            case 'l': queued.input.left = true; break;
+            case 'r': queued.input.right = true; break;
+            case 'u': queued.input.powerUp = true; break;
+            case 'd': queued.input.powerDown = true; break;
+            case 't': queued.input.throwBall = true; break;
+            case 'x': queued.input.reset = true; break;
+            default: break;
+            }
+        }
+        lane->inputs.push_back(queued);
+    } else if (std::strcmp(command, "close") == 0) {
+        const char* id = strtok_r(nullptr, " \t\r", &save);
+        ServerLane* lane = ownedLane(fd, id);
+        if (!lane) {
+            connection.output.append("error bad close\n");
+            return;
+        }
+        std::uint32_t index = static_cast<std::uint32_t>(lane - lanes.data());
+        lane->owner = -1;
+        freeLanes.push_back(index);
+        connection.lanes.erase(std::find(connection.lanes.begin(), connection.lanes.end(), index));
+    } else {
+        connection.output.append("error unknown command\n");
+    }
+}
+
+void TournamentServer::stepLanes() {
+    busyLanes.clear();
+    for (std::size_t id = 0; id < lanes.size(); ++id) {
+        if (lanes[id].owner >= 0 && lanes[id].busy()) {
+            busyLanes.push_back(static_cast<std::uint32_t>(id));
+        }
+    }
+    if (busyLanes.empty()) {
+        return;
+    }
+
+    TRACE_SPAN("batch");
+    int batchTicks = std::max(settings.batchTicks, 1);
+    pool.parallelFor(busyLanes.size(), lanesPerRange, [&](std::size_t begin, std::size_t end, int) {
+        for (std::size_t i = begin; i < end; ++i) {
+            lanes[busyLanes[i]].run(batchTicks);
+        }
+    });
+}
+
+// Stream what happened during the batch back to each lane's client
+void TournamentServer::sendEvents() {
+    char reply[64];
+    for (std::uint32_t id : busyLanes) {
+        ServerLane& lane = lanes[id];
+        ticksRun += lane.ticksRun;
+        lane.ticksRun = 0;
+        if (lane.events.empty()) {
+            continue;
+        }
+        Connection& connection = connections[lane.owner];
+        for (const LaneEvent& event : lane.events) {
+            int length;
+            if (event.gameOver) {
+                gamesFinished++;
+                length = std::snprintf(reply, sizeof(reply), "over %u %d\n", id, event.toppled);
+            } else {
+                throwsFinished++;
+                length = std::snprintf(reply, sizeof(reply), "throw %u %d %d %u\n", id, event.throwNumber,
+                                       event.toppled, static_cast<unsigned>(event.pinMask));
+            }
+            connection.output.append(reply, length);
+        }
+        lane.events.clear();
+    }
+
+    // Replies to requests go out here too, so dropping a client below
+    // cannot invalidate an iterator mid-loop
+    std::vector<int> pending;
+    for (auto& entry : connections) {
+        if (!entry.second.output.empty() && !entry.second.waitingToWrite) {
+            pending.push_back(entry.first);
+        }
+    }
+    for (int fd : pending) {
+        auto found = connections.find(fd);
+        if (found != connections.end()) {
+            writeClient(fd, found->second);
+        }
+    }
+}
+
+void TournamentServer::printStats(double seconds, double cpuSeconds) const {
+    std::printf("Finished %llu games (%llu throws, %llu ticks) in %.2f s on %d threads\n",
+                static_cast<unsigned long long>(gamesFinished), static_cast<unsigned long long>(throwsFinished),
+                static_cast<unsigned long long>(ticksRun), seconds, pool.size());
+    std::printf("%.0f games/s, %.0f games per CPU-second\n", gamesFinished / std::max(seconds, 1e-9),
+                gamesFinished / std::max(cpuSeconds, 1e-9));
+}
+
+}
+
+int runTournamentServer(const TournamentSettings& settings) {
+    TournamentServer server(settings);
+    if (!server.listen()) {
+        return 1;
+    }
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    std::printf("Serving lanes on %s\n", settings.socketPath);
+    std::fflush(stdout);
+
+    auto start = std::chrono::steady_clock::now();
+    std::clock_t cpuStart = std::clock();
+    server.serve();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    server.printStats(seconds, cpuSeconds);
+    return 0;
+}
+
+#else
+
+int runTournamentServer(const TournamentSettings& settings) {
+    std::fprintf(stderr, "The tournament server needs Linux (epoll); cannot serve %s\n", settings.socketPath);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "level_library.h"
+#include "simulation.h"
+
+struct TournamentSettings {
+    const char* socketPath = "bowling.sock";
+    int threads = 0; // 0 means one per hardware thread
+    int batchTicks = 64; // Ticks a busy lane runs between polls of the socket
+    double tickRate = defaultTickRate;
+    int stressPins = 0; // Use a stress rack instead of the 10-pin rack
+    std::vector<Level> levels; // Levels clients can open lanes on by name
+};
+
+// Headless server for bot leagues. Clients connect to a Unix stream socket,
+// open any number of lanes and play them with the same controls as the
+// keyboard. Time on a lane is virtual: it only advances while it has input
+// queued or a throw is still playing out, so lanes run as fast as the CPU
+// allows. Busy lanes are stepped together in batches across the thread pool
+// between polls of an epoll loop.
+//
+// Requests and replies are text, one per line:
+//   open [LEVEL]              -> lane ID TICKRATE, on the named level or
+//                                the standard lane
+//   input ID KEYS [TICKS]     hold KEYS for TICKS ticks (default 1), queued
+//                             after any earlier input. KEYS is "-" for none
+//                             or any of l(eft) r(ight) u(p power) d(own
+//                             power) t(hrow) x (reset).
+//   close ID
+//                             -> throw ID N TOPPLED PINMASK, when throw N
+//                                leaves the lane
+//                             -> over ID SCORE, when the game ends
+//                             -> error MESSAGE
+//
+// Serves until SIGINT or SIGTERM, then prints throughput. Linux only;
+// elsewhere it reports that and fails. Returns the process exit code.
+int runTournamentServer(const TournamentSettings& settings);
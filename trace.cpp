@@ -0,0 +1,117 @@
+#include "trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> tracingActive{false};
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    std::int64_t start;
+    std::int64_t duration;
+};
+
+// One thread's spans. Only the owning thread writes; written is published
+// with release so writeTrace sees complete events.
+struct ThreadTrace {
+    int id;
+    char name[32];
+    std::vector<TraceEvent> events;
+    std::atomic<std::uint64_t> written{0};
+};
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadTrace>> registry;
+std::size_t traceCapacity = defaultTraceEvents;
+std::int64_t traceStart = 0;
+
+thread_local ThreadTrace* currentTrace = nullptr;
+thread_local char currentThreadName[32] = "";
+
+// Buffers outlive their threads so pool workers that have exited still show up
+ThreadTrace* registerThread() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::unique_ptr<ThreadTrace> trace(new ThreadTrace);
+    trace->id = static_cast<int>(registry.size());
+    if (currentThreadName[0] != '\0') {
+        std::snprintf(trace->name, sizeof(trace->name), "%s", currentThreadName);
+    } else {
+        std::snprintf(trace->name, sizeof(trace->name), "thread %d", trace->id);
+    }
+    trace->events.resize(traceCapacity);
+    registry.push_back(std::move(trace));
+    return registry.back().get();
+}
+
+}
+
+void startTracing(std::size_t eventsPerThread) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    traceCapacity = eventsPerThread > 0 ? eventsPerThread : 1;
+    traceStart = traceNow();
+    tracingActive.store(true);
+}
+
+void setTraceThreadName(const char* name, int index) {
+    if (index >= 0) {
+        std::snprintf(currentThreadName, sizeof(currentThreadName), "%s %d", name, index);
+    } else {
+        std::snprintf(currentThreadName, sizeof(currentThreadName), "%s", name);
+    }
+}
+
+std::int64_t traceNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void recordTraceSpan(const char* name, std::int64_t start, std::int64_t end) {
+    ThreadTrace* trace = currentTrace;
+    if (!trace) {
+        trace = currentTrace = registerThread();
+    }
+    std::uint64_t index = trace->written.load(std::memory_order_relaxed);
+    trace->events[index % trace->events.size()] = {name, start, end - start};
+    trace->written.store(index + 1, std::memory_order_release);
+}
+
+bool writeTrace(const char* path) {
+    tracingActive.store(false);
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+
+    std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    bool first = true;
+    std::uint64_t overwritten = 0;
+    for (const std::unique_ptr<ThreadTrace>& trace : registry) {
+        std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                     first ? "" : ",\n", trace->id, trace->name);
+        first = false;
+
+        std::uint64_t written = trace->written.load(std::memory_order_acquire);
+        std::uint64_t capacity = trace->events.size();
+        std::uint64_t begin = written > capacity ? written - capacity : 0;
+        overwritten += begin;
+        for (std::uint64_t i = begin; i < written; ++i) {
+            const TraceEvent& event = trace->events[i % capacity];
+            // Timestamps are microseconds; keep nanosecond precision in the fraction
+            std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                         event.name, trace->id, (event.start - traceStart) * 1e-3, event.duration * 1e-3);
+        }
+    }
+    std::fprintf(file, "\n]}\n");
+
+    if (overwritten > 0) {
+        std::fprintf(stderr, "Trace buffers wrapped: the oldest %llu spans were dropped\n",
+                     static_cast<unsigned long long>(overwritten));
+    }
+    return std::fclose(file) == 0;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Timeline tracing in the Chrome trace-event format (chrome://tracing,
+// ui.perfetto.dev). Every thread records complete spans into its own ring
+// buffer, allocated on its first span, so recording takes no locks; once
+// full, the oldest spans are overwritten. Off by default, in which case a
+// span costs one relaxed load.
+
+// Spans kept per thread
+const std::size_t defaultTraceEvents = 1 << 18;
+
+extern std::atomic<bool> tracingActive;
+
+inline bool traceEnabled() {
+    return tracingActive.load(std::memory_order_relaxed);
+}
+
+// Start recording spans on every thread
+void startTracing(std::size_t eventsPerThread = defaultTraceEvents);
+
+// Stop recording and write everything kept so far to path. Threads must not
+// be inside a span while this runs.
+bool writeTrace(const char* path);
+
+// Label the calling thread in the trace, e.g. ("worker", 3)
+void setTraceThreadName(const char* name, int index = -1);
+
+// Nanoseconds on the tracing clock. name must outlive the trace (a literal).
+std::int64_t traceNow();
+void recordTraceSpan(const char* name, std::int64_t start, std::int64_t end);
+
+// Records the time from construction to destruction
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name)
+        : spanName(traceEnabled() ? name : nullptr), start(spanName ? traceNow() : 0) {}
+
+    ~TraceSpan() {
+        if (spanName) {
+            recordTraceSpan(spanName, start, traceNow());
+        }
+    }
+
+private:
+    const char* spanName;
+    std::int64_t start;
+};
+
+// Trace the rest of the enclosing scope. Compiles to nothing without BOWLING_PROFILE.
+#ifdef BOWLING_PROFILE
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+#else
+#define TRACE_SPAN(name) ((void)0)
+#endif